@@ -24,13 +24,20 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 App::App()
     : bCoutFile(false), bOutputGraphToDraw(false), bOutputGraph(false),
+      bOutputBinaryGraph(false), binaryInput(false), bBatch(false),
+      bJSONOutput(false), bStats(false), bCanonical(false),
       checkCanBeFiniteCovolume(false), checkCocompacity(false),
       checkFiniteCovolume(false), checkArithmeticity(false), computeEuler(true),
       computeGrowthRate(false), computeGrowthSeries(false),
+      checkGrowthRateThreshold(false), computeGrowthRateBounds(false),
       computeSignature(false), debug(false), bIndex2(false), useOpenMP(true),
+      useSymmetries(false), memoryBounded(false), streamedCheck(false),
       printCoxeterGraph(false), printCoxeterMatrix(false),
-      printGramMatrix(false), bPrintHelp(false),
-      ouputMathematicalFormat("generic") {}
+      printGramMatrix(false), bPrintHelp(false), growthRatePrecision(38),
+      growthRateRefinePrecision(0),
+      ouputMathematicalFormat("generic"), out(&cout) {}
+
+void App::set_output(ostream &output) { out = &output; }
 
 bool App::readMainParameters(int argc, char **argv) {
   string temp, prevType, complete;
@@ -60,6 +67,17 @@ bool App::readMainParameters(int argc, char **argv) {
       checkCocompacity = true;
       checkArithmeticity = true;
       prevType = "arithmeticity";
+    } else if (temp == "-batch") {
+      bBatch = true;
+      prevType = "batch";
+    } else if (temp == "-binary" || temp == "-bin") {
+      binaryInput = true;
+      prevType = "binary";
+    } else if (temp == "-cache") {
+      prevType = "cache";
+    } else if (temp == "-canonical") {
+      bCanonical = true;
+      prevType = "canonical";
     } else if (temp == "-c" || temp == "-compacity" || temp == "-compactness" ||
                temp == "-compact" || temp == "-cocompact") {
       checkCocompacity = true;
@@ -104,6 +122,21 @@ bool App::readMainParameters(int argc, char **argv) {
       computeGrowthRate = true;
       prevType = "growthrate";
 #endif
+    } else if (temp == "-grprecision") {
+      prevType = "grprecision";
+    } else if (temp == "-grrefine") {
+      prevType = "grrefine";
+    } else if (temp == "-gr-threshold" || temp == "-grthreshold") {
+      prevType = "grthreshold";
+    } else if (temp == "-gr-bounds" || temp == "-grbounds") {
+      computeGrowthRateBounds = true;
+      prevType = "grbounds";
+    } else if (temp == "-json") {
+      bJSONOutput = true;
+      prevType = "json";
+    } else if (temp == "-stats") {
+      bStats = true;
+      prevType = "stats";
     } else if (temp == "-help") {
       bPrintHelp = true;
       prevType = "help";
@@ -133,14 +166,26 @@ bool App::readMainParameters(int argc, char **argv) {
     } else if (temp == "-oformat" || temp == "-outputformat") {
       prevType = "oformat";
     } else if (temp == "-s" || temp == "-signature") {
-#ifdef _COMPILE_WITH_PARI_
       computeSignature = true;
       prevType = "signature";
-#endif
+    } else if (temp == "-symmetries" || temp == "-sym") {
+      useSymmetries = true;
+      prevType = "symmetries";
+    } else if (temp == "-memorybounded" || temp == "-mb") {
+      memoryBounded = true;
+      prevType = "memorybounded";
+    } else if (temp == "-streamedcheck" || temp == "-sc") {
+      streamedCheck = true;
+      prevType = "streamedcheck";
     } else if (temp == "-writegraph" || temp == "-wg") // write the graph
     {
       bOutputGraph = true;
       prevType = "wg";
+    } else if (temp == "-writebinarygraph" ||
+               temp == "-wgb") // write the graph (binary format)
+    {
+      bOutputBinaryGraph = true;
+      prevType = "wgb";
     } else {
       if (prevType == "i")
         inFilename = temp;
@@ -148,11 +193,45 @@ bool App::readMainParameters(int argc, char **argv) {
         verticesToRemove.push_back(temp);
       else if (prevType == "o")
         outFilenameBasis = temp;
+      else if (prevType == "cache")
+        cacheFilename = temp;
       else if (prevType == "oformat") {
         transform(temp.begin(), temp.end(), temp.begin(), ::tolower);
         if (temp == "gap" || temp == "latex" || temp == "mathematica" ||
             temp == "pari")
           ouputMathematicalFormat = temp;
+      } else if (prevType == "grprecision") {
+        if (temp != "" && temp.length() < 6 &&
+            all_of(temp.begin(), temp.end(), ::isdigit) && std::stoi(temp) > 0)
+          growthRatePrecision = std::stoi(temp);
+      } else if (prevType == "grrefine") {
+        if (temp != "" && temp.length() < 6 &&
+            all_of(temp.begin(), temp.end(), ::isdigit) && std::stoi(temp) > 0)
+          growthRateRefinePrecision = std::stoi(temp);
+      } else if (prevType == "grthreshold") {
+        // Either a/b or a decimal number
+        size_t point(temp.find('.'));
+        string number(temp);
+        if (point != string::npos)
+          number.erase(point, 1);
+
+        // The denominator is checked before canonicalize (GMP aborts on 0)
+        if ((point == string::npos || temp.find('/') == string::npos) &&
+            growthRateThreshold.set_str(number, 10) == 0 &&
+            growthRateThreshold.get_den() != 0) {
+          if (point != string::npos) {
+            mpz_class denominator;
+            mpz_ui_pow_ui(denominator.get_mpz_t(), 10,
+                          temp.size() - point - 1);
+            growthRateThreshold /= denominator;
+          }
+
+          growthRateThreshold.canonicalize();
+          checkGrowthRateThreshold = true;
+        } else {
+          growthRateThreshold = 0;
+          *out << "Error: Invalid growth rate threshold: " << temp << endl;
+        }
       }
 
       prevType = "";
@@ -217,36 +296,36 @@ void App::extractIndex2Subgroup(CoxIter &ci) {
   unsigned int verticesCountStart(ci.get_verticesCount());
 
   if (index2vertex_t0 == "") {
-    cout << "Error: A vertex must be given" << endl;
+    *out << "Error: A vertex must be given" << endl;
     return;
   }
 
   Index2 idx2(&ci);
 
   if (index2vertex_s0 != "") {
-    cout << "This is an experimental feature (to be properly tested)" << endl;
-    cout << "------------------------------------------------------\n" << endl;
+    *out << "This is an experimental feature (to be properly tested)" << endl;
+    *out << "------------------------------------------------------\n" << endl;
 
-    cout << "Infinite sequence:" << endl;
+    *out << "Infinite sequence:" << endl;
 
     if (!idx2.isVertexAdmissible(index2vertex_t0)) {
-      cout << "\tError: " << idx2.get_error() << endl;
+      *out << "\tError: " << idx2.get_error() << endl;
       return;
     }
 
     if (!idx2.isVertexAdmissible(index2vertex_s0)) {
-      cout << "\tError: " << idx2.get_error() << endl;
+      *out << "\tError: " << idx2.get_error() << endl;
       return;
     }
 
     if (!ci.get_dimension()) {
-      cout << "\tError: The dimension must be specified" << endl;
+      *out << "\tError: The dimension must be specified" << endl;
       return;
     }
 
     if (ci.get_coxeterMatrixEntry(ci.get_vertexIndex(index2vertex_t0),
                                   ci.get_vertexIndex(index2vertex_s0)) >= 2) {
-      cout << "\tError: The two hyperplanes must be (ultra)parallel " << endl;
+      *out << "\tError: The two hyperplanes must be (ultra)parallel " << endl;
       return;
     }
 
@@ -255,235 +334,416 @@ void App::extractIndex2Subgroup(CoxIter &ci) {
     auto fVUnits(ci.get_infSeqFVectorsUnits());
     auto fVPowers(ci.get_infSeqFVectorsPowers());
 
-    cout << "\tf-vector after n doubling:\n\t(" << implode(", ", fVUnits)
+    *out << "\tf-vector after n doubling:\n\t(" << implode(", ", fVUnits)
          << ", 1) + 2^(n-1)*(" << implode(", ", fVPowers) << ", 0)" << endl;
   } else
-    cout << "Index two subgroup:" << endl;
+    *out << "Index two subgroup:" << endl;
 
   // -----------------------------------------
   // Doing the GBD
   if (!idx2.removeVertex(index2vertex_t0))
-    cout << "\tError: " << idx2.get_error() << endl;
+    *out << "\tError: " << idx2.get_error() << endl;
   else
-    cout << "\tNumber of new hyperplanes after first doubling: "
+    *out << "\tNumber of new hyperplanes after first doubling: "
          << (ci.get_verticesCount() - verticesCountStart) << endl;
 
-  cout << endl;
+  *out << endl;
 }
 
-void App::run() {
-  if (bPrintHelp) {
-    printHelp();
-    return;
-  }
-
-  chrono::time_point<std::chrono::system_clock> timeStart, timeEnd;
-
-  bool isEulerSuccess(true), canBeFiniteCovolume(false),
-      isSignatureComputed(false);
-
-  CoxIter ci;
+void App::configureCoxIter(CoxIter &ci) const {
+  ci.set_output(*out);
   ci.set_checkCocompactness(checkCocompacity);
   ci.set_checkCofiniteness(checkFiniteCovolume);
   ci.set_debug(debug);
-  ci.set_bWriteInfo(true);
+  ci.set_useOpenMP(useOpenMP);
+  ci.set_useSymmetries(useSymmetries);
+  ci.set_memoryBounded(memoryBounded);
+  ci.set_streamedCheck(streamedCheck);
   ci.set_ouputMathematicalFormat(ouputMathematicalFormat);
   ci.set_verticesToConsider(vertices);
   ci.set_verticesToRemove(verticesToRemove);
+}
 
-  if (bCoutFile)
-    ci.set_sdtOutToFile(outFilenameBasis + ".output");
-
-  Arithmeticity arithmeticity;
-
+void App::computeInvariants(CoxIter &ci, Arithmeticity &arithmeticity,
+                            App_Result &result, const bool &verbose) {
+  chrono::time_point<std::chrono::system_clock> timeStart, timeEnd;
+  chrono::steady_clock::time_point stageStart;
+
+  // Time elapsed since the end of the previous stage
+  auto endStage = [&result, &stageStart](const string &stage) {
+    const chrono::steady_clock::time_point now(chrono::steady_clock::now());
+    result.timings.push_back(
+        make_pair(stage, chrono::duration<double>(now - stageStart).count()));
+    stageStart = now;
+  };
+
+  result.isEulerSuccess = true;
+  result.isCanBeFiniteCovolumeComputed = checkCanBeFiniteCovolume;
+  result.canBeFiniteCovolume = false;
+  result.isSignatureComputed = false;
+  result.growthRateComparison = -1;
+  result.isGrowthRateBoundsComputed = false;
+  result.errors.clear();
+  result.timings.clear();
+  result.isCacheHit = false;
+  result.canonicalHash = "";
+  result.canonicalLabeling.clear();
 #ifdef _COMPILE_WITH_PARI_
-  GrowthRate_Result grr;
-  grr.isComputed = false;
-  grr.perron = -1;
-  grr.pisot = -1;
-  grr.salem = -1;
-
-  array<unsigned int, 3> signature;
+  result.grr.isComputed = false;
+  result.grr.perron = -1;
+  result.grr.pisot = -1;
+  result.grr.salem = -1;
 #endif
 
-  if (isatty(fileno(stdin)) == 0) {
-    if (!ci.parseGraph(std::cin)) {
-      cout << "Error while reading graph: " << ci.get_error() << endl;
-      return;
-    }
-  } else if (inFilename != "") {
-    // Reading of the graph
-    if (!ci.readGraphFromFile(inFilename)) {
-      cout << "Error while reading file: " << ci.get_error() << endl;
-      return;
+  timeStart = chrono::system_clock::now();
+  stageStart = chrono::steady_clock::now();
+
+  // -----------------------------------------------------------------
+  // cache: the invariants which do not depend on the labelling
+  const bool useCache(cacheFilename != "" && !debug &&
+                      !checkCanBeFiniteCovolume && !checkGrowthRateThreshold &&
+                      !computeGrowthRateBounds);
+  string cacheKey;
+
+  if (useCache || bCanonical) {
+    vector<unsigned int> labeling;
+    cacheKey = ci.get_canonicalForm(labeling);
+
+    if (bCanonical) {
+      ostringstream hash;
+      hash << hex << setw(16) << setfill('0')
+           << CoxIter::canonicalHash(cacheKey);
+      result.canonicalHash = hash.str();
+
+      for (const auto &vertex : labeling)
+        result.canonicalLabeling.push_back(ci.get_vertexLabel(vertex));
     }
-  } else {
-    cout << "No input file given\n" << endl;
 
-    printHelp();
-    return;
+    endStage("canonicalForm");
   }
 
-  if (bIndex2)
-    extractIndex2Subgroup(ci);
-
-  if (printGramMatrix)
-    ci.printGramMatrix();
+  if (useCache) {
+    CoxIter_Results cached;
 
-  if (printCoxeterMatrix)
-    ci.printCoxeterMatrix();
-
-  if (printCoxeterGraph)
-    ci.printCoxeterGraph();
+    if (resultsCache.get(cacheKey, cached) &&
+        (!computeEuler || cached.isEulerCharacteristicComputed) &&
+        (!checkCocompacity || cached.isCocompact != -2) &&
+        (!checkFiniteCovolume || cached.isFiniteCovolume != -2) &&
+        (!computeGrowthSeries || cached.isGrowthSeriesComputed)) {
+      ci.set_results(cached);
+      result.isCacheHit = true;
 
-  if (bOutputGraph && !ci.writeGraph(outFilenameBasis))
-    cout << "Error while writing file: " << ci.get_error() << endl;
+      if (verbose)
+        *out << "Results found in the cache......" << endl;
+    }
 
-  if (bOutputGraphToDraw) {
-    if (ci.writeGraphToDraw(outFilenameBasis)) {
-      string command("dot -Tjpg -o\"" + outFilenameBasis + ".jpg\" \"" +
-                     outFilenameBasis + ".graphviz\"");
-#ifdef _DOT_PROGRAM_FOUND_
-      FILE *fin;
-      if ((fin = popen(command.c_str(), "r"))) {
-        cout << "Image created: \n\t" << outFilenameBasis << ".jpg\n" << endl;
-        pclose(fin);
-      } else
-        cout << "GraphViz command: \n\t" << command << "\n" << endl;
-#else
-      cout << "GraphViz command: \n\t" << command << "\n" << endl;
-#endif
-    } else
-      cout << "Error while writing file: " << ci.get_error() << endl;
+    endStage("cache");
   }
 
-  if (bIndex2)
-    return;
-
   // -----------------------------------------------------------------
   // composantes connexes sphériques et euclidiennes
-  cout << "Finding connected subgraphs......" << endl;
-  timeStart = chrono::system_clock::now();
-  ci.exploreGraph();
+  if (verbose && !result.isCacheHit)
+    *out << "Finding connected subgraphs......" << endl;
+  if (!result.isCacheHit)
+    ci.exploreGraph();
 
   try {
     if (checkCanBeFiniteCovolume)
-      canBeFiniteCovolume = ci.canBeFiniteCovolume();
+      result.canBeFiniteCovolume = ci.canBeFiniteCovolume();
   } catch (const string &ex) {
-    checkCanBeFiniteCovolume = false;
-    cout << "\nError:\n\t" << ex << "\n" << endl;
+    result.isCanBeFiniteCovolumeComputed = false;
+    if (verbose)
+      *out << "\nError:\n\t" << ex << "\n" << endl;
+    else
+      result.errors.push_back(ex);
   }
+  if (!result.isCacheHit)
+    endStage("exploreGraph");
 
   // -----------------------------------------------------------------
   // calcul des produits (la majorité du temps de calcul concerne ce bloc)
-  if (computeEuler || computeGrowthSeries || checkCocompacity ||
-      checkFiniteCovolume) {
-    cout << "Finding graphs products......" << endl;
+  if (!result.isCacheHit &&
+      (computeEuler || computeGrowthSeries || checkCocompacity ||
+       checkFiniteCovolume || checkGrowthRateThreshold ||
+       computeGrowthRateBounds)) {
+    if (verbose)
+      *out << "Finding graphs products......" << endl;
     ci.computeGraphsProducts();
+    endStage("computeGraphsProducts");
   }
 
-  unsigned int dimension(ci.get_dimension());
-
-  if (checkFiniteCovolume)
+  if (checkFiniteCovolume && !result.isCacheHit) {
     ci.checkCovolumeFiniteness();
+    endStage("finiteCovolume");
+  }
 
   // -----------------------------------------------------------------
   // calcul de la caractéristique d'Euler, f-vecteur et compacité
-  cout << "Computations......" << endl;
-  if (computeEuler && !ci.computeEulerCharacteristicFVector()) {
-    isEulerSuccess = false;
-    cout << "\n\n##############################################################"
-            "########"
-         << endl;
-    cout << "\tAn error occurred." << endl;
-    cout << "\tCheck the graph encoding." << endl;
-    cout << "\tYou can run CoxIter with option '-debug' to see if the graph "
-            "contains a spherical subgraph which has too big rank."
-         << endl;
-    cout << "##################################################################"
-            "####\n"
-         << endl;
+  if (verbose && !result.isCacheHit)
+    *out << "Computations......" << endl;
+  if (computeEuler && !result.isCacheHit &&
+      !ci.computeEulerCharacteristicFVector()) {
+    result.isEulerSuccess = false;
+    if (verbose) {
+      *out << "\n\n##########################################################"
+              "############"
+           << endl;
+      *out << "\tAn error occurred." << endl;
+      *out << "\tCheck the graph encoding." << endl;
+      *out << "\tYou can run CoxIter with option '-debug' to see if the graph "
+              "contains a spherical subgraph which has too big rank."
+           << endl;
+      *out << "##############################################################"
+              "########\n"
+           << endl;
+    } else
+      result.errors.push_back("Euler characteristic: check the graph encoding");
   }
+  if (computeEuler && !result.isCacheHit)
+    endStage("eulerCharacteristic");
 
-  if (checkCocompacity)
+  if (checkCocompacity && !result.isCacheHit) {
     ci.isGraphCocompact();
+    endStage("cocompactness");
+  }
 
-  if (checkArithmeticity)
+  if (checkArithmeticity) {
     arithmeticity.test(ci, true);
+    endStage("arithmeticity");
+  }
 
-  if (computeGrowthSeries) {
+  if (checkGrowthRateThreshold) {
+    result.growthRateComparison = ci.growthRate_compare(growthRateThreshold);
+    endStage("growthRateThreshold");
+  }
+
+  if (computeGrowthRateBounds) {
+    result.isGrowthRateBoundsComputed = ci.growthRate_bounds(
+        result.growthRateLower, result.growthRateUpper);
+
+    if (!result.isGrowthRateBoundsComputed) {
+      if (verbose)
+        *out << "\nError:\n\t" << ci.get_error() << "\n" << endl;
+      else
+        result.errors.push_back(ci.get_error());
+    }
+    endStage("growthRateBounds");
+  }
+
+  if (computeGrowthSeries && !result.isCacheHit) {
     ci.growthSeries();
+    endStage("growthSeries");
   }
 
-  if (ci.get_hasDottedLineWithoutWeight() != 0)
-    computeSignature = false;
+  if (useCache && !result.isCacheHit) {
+    CoxIter_Results results(ci.get_results());
+    results.isEulerCharacteristicComputed =
+        computeEuler && result.isEulerSuccess;
 
-  if (computeSignature) {
+    if (!resultsCache.put(cacheKey, results)) {
+      if (verbose)
+        *out << "\nError:\n\t" << resultsCache.get_error() << "\n" << endl;
+      else
+        result.errors.push_back(resultsCache.get_error());
+    }
+  }
+
+  if (computeSignature && ci.get_hasDottedLineWithoutWeight() == 0) {
 #ifdef _COMPILE_WITH_PARI_
     try {
-      Signature s;
-      signature = s.computeSignature(ci.get_gramMatrix_PARI());
-      isSignatureComputed = true;
+      lock_guard<mutex> lock(pariMutex); // PARI is not thread-safe
+      if (!signatureComputer)
+        signatureComputer.reset(new Signature());
+      result.signature =
+          signatureComputer->computeSignature(ci.get_gramMatrix_PARI());
+      result.isSignatureComputed = true;
     } catch (const string &ex) {
-      cout << "\n---------------------------------------------------------"
-           << endl;
-      cout << "Error while computing the signature:\n\t" << ex << endl;
-      cout << "---------------------------------------------------------\n"
-           << endl;
+      if (verbose) {
+        *out << "\n---------------------------------------------------------"
+             << endl;
+        *out << "Error while computing the signature:\n\t" << ex << endl;
+        *out << "---------------------------------------------------------\n"
+             << endl;
+      } else
+        result.errors.push_back(ex);
+    }
+#else
+    if (!ci.get_hasDottedLine()) {
+      result.signature = ci.gramMatrixSignature();
+      result.isSignatureComputed = true;
     }
 #endif
+    endStage("signature");
   }
 
   if (computeGrowthRate) {
 #ifdef _COMPILE_WITH_PARI_
     try {
-      GrowthRate gr;
-      grr = gr.grrComputations(ci.get_growthSeries_denominator());
+      lock_guard<mutex> lock(pariMutex); // PARI is not thread-safe
+      if (!growthRateComputer)
+        growthRateComputer.reset(new GrowthRate(growthRatePrecision));
+      else // refine changes the precision
+        growthRateComputer->set_precision(growthRatePrecision);
+
+      result.grr = growthRateComputer->grrComputations(
+          ci.get_growthSeries_denominator());
+      if (growthRateRefinePrecision)
+        result.grr = growthRateComputer->refine(growthRateRefinePrecision);
     } catch (const string &ex) {
-      cout << "\n---------------------------------------------------------"
-           << endl;
-      cout << "Error while computing the growth rate:\n\t" << ex << endl;
-      cout << "---------------------------------------------------------\n"
-           << endl;
+      if (verbose) {
+        *out << "\n---------------------------------------------------------"
+             << endl;
+        *out << "Error while computing the growth rate:\n\t" << ex << endl;
+        *out << "---------------------------------------------------------\n"
+             << endl;
+      } else
+        result.errors.push_back(ex);
     }
+    endStage("growthRate");
 #endif
   }
 
   timeEnd = chrono::system_clock::now();
-  cout << "\tComputation time: "
-       << chrono::duration<double, milli>(timeEnd - timeStart).count() / 1000
-       << "s\n"
+  result.computationTime =
+      chrono::duration<double, milli>(timeEnd - timeStart).count() / 1000;
+}
+
+void App::run() {
+  if (bPrintHelp) {
+    printHelp();
+    return;
+  }
+
+  if (cacheFilename != "" && !resultsCache.open(cacheFilename)) {
+    *out << "Error: " << resultsCache.get_error() << endl;
+    return;
+  }
+
+  if (bBatch) {
+    runBatch();
+    return;
+  }
+
+  CoxIter ci;
+  configureCoxIter(ci);
+  ci.set_bWriteInfo(!bJSONOutput);
+
+  Arithmeticity arithmeticity;
+  App_Result result;
+
+  if (isatty(fileno(stdin)) == 0) {
+    if (!(binaryInput ? ci.parseBinaryGraph(std::cin)
+                      : ci.parseGraph(std::cin))) {
+      if (bJSONOutput)
+        printErrorRecord(*out, "", ci.get_error());
+      else
+        *out << "Error while reading graph: " << ci.get_error() << endl;
+      return;
+    }
+  } else if (inFilename != "") {
+    // Reading of the graph
+    if (!(binaryInput ? ci.readGraphFromBinaryFile(inFilename)
+                      : ci.readGraphFromFile(inFilename))) {
+      if (bJSONOutput)
+        printErrorRecord(*out, inFilename, ci.get_error());
+      else
+        *out << "Error while reading file: " << ci.get_error() << endl;
+      return;
+    }
+  } else {
+    *out << "No input file given\n" << endl;
+
+    printHelp();
+    return;
+  }
+
+  if (bIndex2)
+    extractIndex2Subgroup(ci);
+
+  if (printGramMatrix)
+    ci.printGramMatrix();
+
+  if (printCoxeterMatrix)
+    ci.printCoxeterMatrix();
+
+  if (printCoxeterGraph)
+    ci.printCoxeterGraph();
+
+  if (bOutputGraph && !ci.writeGraph(outFilenameBasis))
+    *out << "Error while writing file: " << ci.get_error() << endl;
+
+  if (bOutputBinaryGraph && !ci.writeBinaryGraph(outFilenameBasis))
+    *out << "Error while writing file: " << ci.get_error() << endl;
+
+  if (bOutputGraphToDraw) {
+    if (ci.writeGraphToDraw(outFilenameBasis)) {
+      string command("dot -Tjpg -o\"" + outFilenameBasis + ".jpg\" \"" +
+                     outFilenameBasis + ".graphviz\"");
+#ifdef _DOT_PROGRAM_FOUND_
+      FILE *fin;
+      if ((fin = popen(command.c_str(), "r"))) {
+        *out << "Image created: \n\t" << outFilenameBasis << ".jpg\n" << endl;
+        pclose(fin);
+      } else
+        *out << "GraphViz command: \n\t" << command << "\n" << endl;
+#else
+      *out << "GraphViz command: \n\t" << command << "\n" << endl;
+#endif
+    } else
+      *out << "Error while writing file: " << ci.get_error() << endl;
+  }
+
+  if (bIndex2)
+    return;
+
+  computeInvariants(ci, arithmeticity, result, !bJSONOutput);
+
+  if (bJSONOutput) {
+    printRecord(*out, inFilename, ci, result);
+    return;
+  }
+
+  unsigned int dimension(ci.get_dimension());
+
+  *out << "\tComputation time: " << result.computationTime << "s"
+       << (result.isCacheHit ? " (results found in the cache)" : "") << "\n"
        << endl;
 
   // -----------------------------------------------------------------
   // Affichage des informations
-  cout << "Information" << endl;
+  *out << "Information" << endl;
 
   if (ci.get_dimensionGuessed())
-    cout << "\tGuessed dimension: " << ci.get_dimension() << endl;
+    *out << "\tGuessed dimension: " << ci.get_dimension() << endl;
+
+  if (bCanonical) {
+    *out << "\tCanonical hash: " << result.canonicalHash << endl;
+    *out << "\tCanonical labeling: " << implode(", ", result.canonicalLabeling)
+         << endl;
+  }
 
-  cout << "\tCocompact: "
+  *out << "\tCocompact: "
        << (ci.get_isCocompact() >= 0
                ? (ci.get_isCocompact() == 0 ? "no" : "yes")
                : "?")
        << endl;
-  if (checkCanBeFiniteCovolume)
-    cout << "\tCan be of finite covolume: "
-         << (canBeFiniteCovolume ? "yes" : "no") << endl;
+  if (result.isCanBeFiniteCovolumeComputed)
+    *out << "\tCan be of finite covolume: "
+         << (result.canBeFiniteCovolume ? "yes" : "no") << endl;
 
-  cout << "\tFinite covolume: "
+  *out << "\tFinite covolume: "
        << (ci.get_isFiniteCovolume() >= 0
                ? (ci.get_isFiniteCovolume() == 0 ? "no" : "yes")
                : "?")
        << endl;
   if (checkArithmeticity) {
-    cout << "\tArithmetic: ";
+    *out << "\tArithmetic: ";
     if (ci.get_isArithmetic() == 1)
-      cout << "yes" << endl;
+      *out << "yes" << endl;
     else if (ci.get_isArithmetic() == 0)
-      cout << "no" << endl;
+      *out << "no" << endl;
     else
-      cout << "?"
+      *out << "?"
            << (arithmeticity.get_error() != ""
                    ? "(" + arithmeticity.get_error() + ")"
                    : (ci.get_hasDottedLine() ? " (GRAPH HAS DOTTED EDGE)" : ""))
@@ -491,29 +751,29 @@ void App::run() {
   }
 
   // f-vector, alternating sum of the components of the f-vector
-  if (computeEuler && isEulerSuccess) {
+  if (computeEuler && result.isEulerSuccess) {
     if (dimension) {
       const auto fVector(ci.get_fVector());
 
-      cout << "\tf-vector: (";
+      *out << "\tf-vector: (";
       for (unsigned int i(0); i <= dimension; i++)
-        cout << (i ? ", " : "") << fVector[i];
-      cout << ")" << endl;
+        *out << (i ? ", " : "") << fVector[i];
+      *out << ")" << endl;
 
-      cout << "\tNumber of vertices at infinity: "
+      *out << "\tNumber of vertices at infinity: "
            << ci.get_verticesAtInfinityCount() << endl;
 
-      cout << "\tAlternating sum of the components of the f-vector: "
+      *out << "\tAlternating sum of the components of the f-vector: "
            << ci.get_fVectorAlternateSum() << endl;
     }
 
-    cout << "\tEuler characteristic: " << ci.get_brEulerCaracteristic() << endl;
+    *out << "\tEuler characteristic: " << ci.get_brEulerCaracteristic() << endl;
   }
 
   // volume
-  if (computeEuler && dimension && isEulerSuccess && !(dimension % 2) &&
+  if (computeEuler && dimension && result.isEulerSuccess && !(dimension % 2) &&
       ci.get_isFiniteCovolume() == 1) {
-    cout << "\tCovolume: ";
+    *out << "\tCovolume: ";
 
     MPZ_rational cov((dimension / 2) % 2 ? -1 : 1);
     for (unsigned int i(1); i <= dimension; i++) {
@@ -523,31 +783,47 @@ void App::run() {
         cov *= i;
     }
 
-    cout << "pi^" << (dimension / 2) << " * "
+    *out << "pi^" << (dimension / 2) << " * "
          << cov * ci.get_brEulerCaracteristic() << endl;
   }
 
-  if (isSignatureComputed) {
-#ifdef _COMPILE_WITH_PARI_
-    cout << "\tSignature (numerically): " << signature[0] << "," << signature[1]
-         << "," << signature[2] << endl;
-#endif
-  }
+  if (checkGrowthRateThreshold)
+    *out << "\tGrowth rate >= " << growthRateThreshold << ": "
+         << (result.growthRateComparison < 0
+                 ? "?"
+                 : (result.growthRateComparison ? "yes" : "no"))
+         << endl;
+
+  if (result.isGrowthRateBoundsComputed)
+    *out << "\tGrowth rate between "
+         << growthRateBoundToString(result.growthRateLower, false) << " and "
+         << growthRateBoundToString(result.growthRateUpper, true) << endl;
+
+  if (result.isSignatureComputed)
+    *out << "\tSignature (numerically): " << result.signature[0] << ","
+         << result.signature[1] << "," << result.signature[2] << endl;
 
   if (computeGrowthSeries) {
-    cout << "\nGrowth series: " << endl;
+    *out << "\nGrowth series: " << endl;
     ci.printGrowthSeries();
-    cout << endl;
+    *out << endl;
 
 #ifdef _COMPILE_WITH_PARI_
-    if (computeGrowthRate && grr.isComputed && ci.get_isGrowthSeriesReduced()) {
-      cout << "\nGrowth rate: " << grr.growthRate << endl;
-      cout << "\tPerron number: "
-           << (grr.perron < 0 ? "?" : (grr.perron > 0 ? "yes" : "no")) << endl;
-      cout << "\tPisot number: "
-           << (grr.pisot < 0 ? "?" : (grr.pisot > 0 ? "yes" : "no")) << endl;
-      cout << "\tSalem number: "
-           << (grr.salem < 0 ? "?" : (grr.salem > 0 ? "yes" : "no")) << endl;
+    if (computeGrowthRate && result.grr.isComputed &&
+        ci.get_isGrowthSeriesReduced()) {
+      *out << "\nGrowth rate: " << result.grr.growthRate << endl;
+      *out << "\tPerron number: "
+           << (result.grr.perron < 0 ? "?"
+                                     : (result.grr.perron > 0 ? "yes" : "no"))
+           << endl;
+      *out << "\tPisot number: "
+           << (result.grr.pisot < 0 ? "?"
+                                    : (result.grr.pisot > 0 ? "yes" : "no"))
+           << endl;
+      *out << "\tSalem number: "
+           << (result.grr.salem < 0 ? "?"
+                                    : (result.grr.salem > 0 ? "yes" : "no"))
+           << endl;
     }
 #endif
   }
@@ -556,15 +832,15 @@ void App::run() {
     vector<string> cycles(arithmeticity.get_allCycles());
 
     if (cycles.size()) {
-      cout << "\nThe group is arithmetic if and only if all the following "
+      *out << "\nThe group is arithmetic if and only if all the following "
               "values lie in Z: \n";
       auto weights(ci.get_weights());
 
-      cout << implode("\n", cycles) << endl;
+      *out << implode("\n", cycles) << endl;
       if (weights.size()) {
-        cout << "with" << endl;
+        *out << "with" << endl;
         for (auto it : weights)
-          cout << "l"
+          *out << "l"
                << linearizationMatrix_row(it.first, ci.get_verticesCount())
                << "m"
                << linearizationMatrix_col(it.first, ci.get_verticesCount())
@@ -573,11 +849,524 @@ void App::run() {
     }
   }
 
-  cout << endl;
+  if (bStats) {
+    const CoxIter_Stats stats(ci.get_stats());
+
+    *out << "\nStatistics" << endl;
+    *out << "\tConnected spherical graphs: " << stats.sphericalGraphsCount
+         << endl;
+    *out << "\tConnected euclidean graphs: " << stats.euclideanGraphsCount
+         << endl;
+    *out << "\tGraphs products enumerated: " << stats.productsCount << endl;
+    *out << "\tDistinct graphs products: " << stats.footprintsCount << endl;
+    *out << "\tExtension tests: " << stats.extensionTestsCount << endl;
+    *out << "\tCalls to isSubgraphOf: " << stats.isSubgraphOfCount << endl;
+    *out << "\tPeak memory: " << stats.peakMemory << " kB" << endl;
+
+    *out << "\tTime per step:" << endl;
+    for (const auto &timing : result.timings)
+      *out << "\t\t" << timing.first << ": " << timing.second << "s" << endl;
+  }
+
+  *out << endl;
+}
+
+void App::runBatch() {
+  // -----------------------------------------------------------------
+  // Directory: every file with the right extension
+  struct stat fileStat;
+  if (inFilename != "" && stat(inFilename.c_str(), &fileStat) == 0 &&
+      S_ISDIR(fileStat.st_mode)) {
+    const string extension(binaryInput ? ".coxiterb" : ".coxiter");
+    vector<string> filenames;
+
+    DIR *directory(opendir(inFilename.c_str()));
+    if (!directory) {
+      *out << "Error while reading directory: " << inFilename << endl;
+      return;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(directory))) {
+      string filename(entry->d_name);
+      if (filename.size() > extension.size() &&
+          filename.compare(filename.size() - extension.size(),
+                           extension.size(), extension) == 0)
+        filenames.push_back(filename);
+    }
+    closedir(directory);
+
+    sort(filenames.begin(), filenames.end());
+
+    vector<App_BatchJob> jobs;
+    for (const auto &filename : filenames) {
+      jobs.push_back(App_BatchJob({filename, inFilename + "/" + filename, ""}));
+
+      if (jobs.size() == batchChunkSize()) {
+        runBatchJobs(jobs);
+        jobs.clear();
+      }
+    }
+    runBatchJobs(jobs);
+
+    return;
+  }
+
+  // -----------------------------------------------------------------
+  // Stream: file or stdin
+  ifstream fileIn;
+  if (inFilename != "") {
+    fileIn.open(inFilename.c_str(), ios::binary);
+    if (fileIn.fail()) {
+      *out << "Error while reading file: " << inFilename << endl;
+      return;
+    }
+  } else if (isatty(fileno(stdin)) != 0) {
+    *out << "No input file given\n" << endl;
+
+    printHelp();
+    return;
+  }
+
+  istream &streamIn(inFilename != "" ? static_cast<istream &>(fileIn) : cin);
+  unsigned int graphsCount(0);
+  vector<App_BatchJob> jobs;
+
+  if (binaryInput) {
+    // The graphs are concatenated: each one gives its size
+    const string content((istreambuf_iterator<char>(streamIn)),
+                         istreambuf_iterator<char>());
+    size_t position(0), recordSize;
+
+    while (position < content.size()) {
+      recordSize = CoxIter::binaryGraphSize(content.data() + position,
+                                            content.size() - position);
+
+      // If the record is invalid, the parser will give the error and we
+      // cannot find the next graph
+      jobs.push_back(App_BatchJob(
+          {to_string(++graphsCount), "",
+           content.substr(position, recordSize ? recordSize : string::npos)}));
+
+      if (!recordSize)
+        break;
+
+      position += recordSize;
+
+      if (jobs.size() == batchChunkSize()) {
+        runBatchJobs(jobs);
+        jobs.clear();
+      }
+    }
+    runBatchJobs(jobs);
+
+    return;
+  }
+
+  string line, graph, name;
+  bool hasNextGraph(true);
+
+  while (hasNextGraph) {
+    hasNextGraph = static_cast<bool>(getline(streamIn, line));
+
+    if (hasNextGraph && line.compare(0, 3, "---") != 0) {
+      graph += line + "\n";
+      continue;
+    }
+
+    // End of a graph
+    if (graph.find_first_not_of(" \t\r\n") != string::npos) {
+      graphsCount++;
+      jobs.push_back(App_BatchJob(
+          {name != "" ? name : to_string(graphsCount), "", graph}));
+
+      if (jobs.size() == batchChunkSize()) {
+        runBatchJobs(jobs);
+        jobs.clear();
+      }
+    }
+
+    graph.clear();
+    if (hasNextGraph) {
+      name = line.substr(3);
+      name.erase(0, name.find_first_not_of(" \t"));
+      name.erase(name.find_last_not_of(" \t\r") + 1);
+    }
+  }
+  runBatchJobs(jobs);
+}
+
+size_t App::batchChunkSize() const {
+  return 64 * (useOpenMP ? omp_get_max_threads() : 1);
+}
+
+void App::runBatchJobs(const vector<App_BatchJob> &jobs) {
+  if (jobs.empty())
+    return;
+
+  // -----------------------------------------------------------------
+  // One CoxIter (and Arithmeticity) per thread
+  const unsigned int threadsCount(useOpenMP ? omp_get_max_threads() : 1);
+  while (batchCoxIters.size() < threadsCount) {
+    batchCoxIters.push_back(unique_ptr<CoxIter>(new CoxIter));
+    configureCoxIter(*batchCoxIters.back());
+    batchCoxIters.back()->set_bWriteInfo(false);
+
+    batchArithmeticities.push_back(
+        unique_ptr<Arithmeticity>(new Arithmeticity));
+  }
+
+  const size_t jobsCount(jobs.size());
+  vector<string> records(jobsCount); // Empty if the graph was deferred
+
+  // Reads the graph, computes and prints the record in records[i]
+  auto analyseJob = [this, &jobs, &records](const size_t &i, CoxIter &ci,
+                                            Arithmeticity &arithmeticity,
+                                            const bool &isBigGraphDeferred) {
+    const App_BatchJob &job(jobs[i]);
+    bool isRead;
+
+    if (job.path != "")
+      isRead = binaryInput ? ci.readGraphFromBinaryFile(job.path)
+                           : ci.readGraphFromFile(job.path);
+    else if (binaryInput)
+      isRead = ci.parseBinaryGraph(job.content.data(), job.content.size());
+    else {
+      istringstream graphIn(job.content);
+      isRead = ci.parseGraph(graphIn);
+    }
+
+    ostringstream record;
+    if (!isRead)
+      printErrorRecord(record, job.name, ci.get_error());
+    else if (isBigGraphDeferred && ci.get_verticesCount() >= 15)
+      return;
+    else {
+      App_Result result;
+      computeInvariants(ci, arithmeticity, result, false);
+      printRecord(record, job.name, ci, result);
+    }
+
+    records[i] = record.str();
+  };
+
+  // -----------------------------------------------------------------
+  // Phase 1: one graph per thread; the big graphs (for which CoxIter uses
+  // itself OpenMP) are deferred
+  for (unsigned int i(0); i < threadsCount; i++)
+    batchCoxIters[i]->set_useOpenMP(false);
+
+#pragma omp parallel for if (useOpenMP) schedule(dynamic)
+  for (size_t i = 0; i < jobsCount; i++) {
+    const unsigned int threadId(omp_get_thread_num());
+    analyseJob(i, *batchCoxIters[threadId], *batchArithmeticities[threadId],
+               useOpenMP);
+  }
+
+  // -----------------------------------------------------------------
+  // Phase 2: the big graphs, one after the other, with all the threads
+  batchCoxIters[0]->set_useOpenMP(useOpenMP);
+  for (size_t i(0); i < jobsCount; i++) {
+    if (records[i].empty())
+      analyseJob(i, *batchCoxIters[0], *batchArithmeticities[0], false);
+
+    *out << records[i];
+  }
+  out->flush();
+}
+
+void App::printRecord(ostream &out, const string &name, CoxIter &ci,
+                      const App_Result &result) {
+  if (bJSONOutput) {
+    printRecordJSON(out, name, ci, result);
+    return;
+  }
+
+  auto yesNo = [](const int &value) -> string {
+    return value >= 0 ? (value == 0 ? "no" : "yes") : "?";
+  };
+
+  const unsigned int dimension(ci.get_dimension());
+
+  out << name << "\tvertices=" << ci.get_verticesCount()
+      << "\tdimension=" << dimension;
+
+  if (result.isCacheHit)
+    out << "\tcached=yes";
+
+  if (bCanonical)
+    out << "\tcanonical hash=" << result.canonicalHash
+        << "\tcanonical labeling=" << implode(",", result.canonicalLabeling);
+
+  if (checkCocompacity)
+    out << "\tcocompact=" << yesNo(ci.get_isCocompact());
+
+  if (checkFiniteCovolume)
+    out << "\tfinite covolume=" << yesNo(ci.get_isFiniteCovolume());
+
+  if (result.isCanBeFiniteCovolumeComputed)
+    out << "\tcan be of finite covolume="
+        << (result.canBeFiniteCovolume ? "yes" : "no");
+
+  if (checkArithmeticity)
+    out << "\tarithmetic=" << yesNo(ci.get_isArithmetic());
+
+  if (computeEuler && result.isEulerSuccess) {
+    if (dimension) {
+      const auto fVector(ci.get_fVector());
+
+      out << "\tf-vector=(";
+      for (unsigned int i(0); i <= dimension; i++)
+        out << (i ? ", " : "") << fVector[i];
+      out << ")";
+    }
+
+    out << "\tEuler characteristic=" << ci.get_brEulerCaracteristic();
+  }
+
+  if (checkGrowthRateThreshold)
+    out << "\tgrowth rate >= " << growthRateThreshold << "="
+        << yesNo(result.growthRateComparison);
+
+  if (result.isGrowthRateBoundsComputed)
+    out << "\tgrowth rate in ["
+        << growthRateBoundToString(result.growthRateLower, false) << ","
+        << growthRateBoundToString(result.growthRateUpper, true) << "]";
+
+  if (result.isSignatureComputed)
+    out << "\tsignature=" << result.signature[0] << ","
+        << result.signature[1] << "," << result.signature[2];
+
+  if (computeGrowthSeries) {
+    string growthSeries(ci.get_growthSeries());
+    str_replace(growthSeries, "\n", " ");
+    out << "\tgrowth series=" << growthSeries;
+  }
+
+#ifdef _COMPILE_WITH_PARI_
+  if (computeGrowthRate && result.grr.isComputed &&
+      ci.get_isGrowthSeriesReduced())
+    out << "\tgrowth rate=" << result.grr.growthRate;
+#endif
+
+  for (const auto &error : result.errors)
+    out << "\terror=" << error;
+
+  if (bStats) {
+    const CoxIter_Stats stats(ci.get_stats());
+
+    out << "\tproducts=" << stats.productsCount
+        << "\tdistinct products=" << stats.footprintsCount
+        << "\textension tests=" << stats.extensionTestsCount
+        << "\tisSubgraphOf=" << stats.isSubgraphOfCount
+        << "\tpeak memory=" << stats.peakMemory;
+
+    for (const auto &timing : result.timings)
+      out << "\ttime " << timing.first << "=" << timing.second;
+  }
+
+  out << "\ttime=" << result.computationTime << endl;
+}
+
+void App::printRecordJSON(ostream &out, const string &name, CoxIter &ci,
+                          const App_Result &result) {
+  JSONWriter json(out);
+
+  // 1: true, 0: false, otherwise: unknown
+  auto triState = [&json](const int &value) {
+    if (value == 0 || value == 1)
+      json.value(value == 1);
+    else
+      json.null();
+  };
+
+  const unsigned int dimension(ci.get_dimension());
+
+  json.beginObject();
+  json.key("name").value(name);
+  json.key("vertices").value(ci.get_verticesCount());
+  json.key("dimension").value(dimension);
+  json.key("dimensionGuessed").value(ci.get_dimensionGuessed());
+  json.key("cached").value(result.isCacheHit);
+
+  if (bCanonical) {
+    json.key("canonicalHash").value(result.canonicalHash);
+    json.key("canonicalLabeling").beginArray();
+    for (const auto &vertex : result.canonicalLabeling)
+      json.value(vertex);
+    json.endArray();
+  }
+
+  if (checkCocompacity) {
+    json.key("cocompact");
+    triState(ci.get_isCocompact());
+  }
+
+  if (checkFiniteCovolume) {
+    json.key("finiteCovolume");
+    triState(ci.get_isFiniteCovolume());
+  }
+
+  if (result.isCanBeFiniteCovolumeComputed)
+    json.key("canBeFiniteCovolume").value(result.canBeFiniteCovolume);
+
+  if (checkArithmeticity) {
+    json.key("arithmetic");
+    triState(ci.get_isArithmetic());
+  }
+
+  if (computeEuler && result.isEulerSuccess) {
+    if (dimension) {
+      json.key("fVector").beginArray();
+      for (const auto &f : ci.get_fVector())
+        json.value(f);
+      json.endArray();
+
+      json.key("verticesAtInfinity").value(ci.get_verticesAtInfinityCount());
+      json.key("fVectorAlternateSum").value(ci.get_fVectorAlternateSum());
+    }
+
+    json.key("eulerCharacteristic")
+        .value(ci.get_brEulerCaracteristic().to_string());
+  }
+
+  if (checkGrowthRateThreshold) {
+    json.key("growthRateThreshold").beginObject();
+    json.key("threshold").value(growthRateThreshold.get_str());
+    json.key("greaterOrEqual");
+    triState(result.growthRateComparison);
+    json.endObject();
+  }
+
+  if (result.isGrowthRateBoundsComputed) {
+    json.key("growthRateBounds").beginObject();
+    json.key("lower").value(result.growthRateLower.get_str());
+    json.key("upper").value(result.growthRateUpper.get_str());
+    json.endObject();
+  }
+
+  if (result.isSignatureComputed) {
+    json.key("signature").beginArray();
+    for (const auto &s : result.signature)
+      json.value(s);
+    json.endArray();
+  }
+
+  if (computeGrowthSeries) {
+    vector<unsigned int> cyclotomicNumerator;
+    vector<mpz_class> polynomialDenominator;
+    bool isReduced;
+    ci.get_growthSeries(cyclotomicNumerator, polynomialDenominator, isReduced);
+
+    json.key("growthSeries").beginObject();
+    json.key("cyclotomicNumerator").beginArray();
+    for (const auto &c : cyclotomicNumerator)
+      json.value(c);
+    json.endArray();
+
+    json.key("denominator").beginArray();
+    for (const auto &c : polynomialDenominator)
+      json.number(c.get_str());
+    json.endArray();
+
+    json.key("reduced").value(isReduced);
+    json.endObject();
+  }
+
+#ifdef _COMPILE_WITH_PARI_
+  if (computeGrowthRate && result.grr.isComputed &&
+      ci.get_isGrowthSeriesReduced()) {
+    json.key("growthRate").beginObject();
+    json.key("value").value(result.grr.growthRate);
+    json.key("perron");
+    triState(result.grr.perron);
+    json.key("pisot");
+    triState(result.grr.pisot);
+    json.key("salem");
+    triState(result.grr.salem);
+    json.endObject();
+  }
+#endif
+
+  if (!result.errors.empty()) {
+    json.key("errors").beginArray();
+    for (const auto &error : result.errors)
+      json.value(error);
+    json.endArray();
+  }
+
+  json.key("timings").beginObject();
+  for (const auto &timing : result.timings)
+    json.key(timing.first).value(timing.second);
+  json.key("total").value(result.computationTime);
+  json.endObject();
+
+  if (bStats) {
+    const CoxIter_Stats stats(ci.get_stats());
+
+    json.key("stats").beginObject();
+    json.key("sphericalGraphs").value(stats.sphericalGraphsCount);
+    json.key("euclideanGraphs").value(stats.euclideanGraphsCount);
+    json.key("products").value(stats.productsCount);
+    json.key("distinctProducts").value(stats.footprintsCount);
+    json.key("extensionTests").value(stats.extensionTestsCount);
+    json.key("isSubgraphOfCalls").value(stats.isSubgraphOfCount);
+    json.key("peakMemory").value(stats.peakMemory);
+
+    json.key("times").beginObject();
+    json.key("exploreGraph").value(stats.exploreGraphTime);
+    json.key("computeGraphsProducts").value(stats.graphsProductsTime);
+    json.key("canBeFiniteCovolume").value(stats.canBeFiniteCovolumeTime);
+    json.key("cocompactness").value(stats.cocompactnessTime);
+    json.key("finiteCovolume").value(stats.finiteCovolumeTime);
+    json.key("eulerCharacteristic").value(stats.eulerCharacteristicTime);
+    json.key("growthSeries").value(stats.growthSeriesTime);
+    json.endObject();
+
+    json.endObject();
+  }
+
+  json.endObject();
+  out << '\n';
+}
+
+void App::printErrorRecord(ostream &out, const string &name,
+                           const string &error) {
+  if (bJSONOutput) {
+    JSONWriter json(out);
+    json.beginObject();
+    json.key("name").value(name);
+    json.key("error").value(error);
+    json.endObject();
+    out << '\n';
+  } else
+    out << (name != "" ? name + "\t" : "") << "error=" << error << endl;
+}
+
+string App::growthRateBoundToString(const mpq_class &bound,
+                                    const bool &roundUp) const {
+  // The interval which is displayed still contains the growth rate
+  mpz_class power10, digits;
+  mpz_ui_pow_ui(power10.get_mpz_t(), 10, 15);
+
+  const mpq_class scaled(bound * power10);
+  if (roundUp)
+    mpz_cdiv_q(digits.get_mpz_t(), scaled.get_num_mpz_t(),
+               scaled.get_den_mpz_t());
+  else
+    mpz_fdiv_q(digits.get_mpz_t(), scaled.get_num_mpz_t(),
+               scaled.get_den_mpz_t());
+
+  string str(digits.get_str());
+  if (str.size() < 16)
+    str.insert(0, 16 - str.size(), '0');
+  str.insert(str.size() - 15, ".");
+
+  return str;
 }
 
 void App::printHelp() const {
-  cout << "  _____          _____ _            \n"
+  *out << "  _____          _____ _            \n"
           " / ____|        |_   _| |\n"
           "| |     _____  __ | | | |_ ___ _ __ \n"
           "| |    / _ \\ \\/ / | | | __/ _ \\ '__|\n"
@@ -585,7 +1374,7 @@ void App::printHelp() const {
           " \\_____\\___/_/\\_\\_____|\\__\\___|_|   \n"
        << endl;
 
-  cout << "CoxIter is a program to compute invariants of hyperbolic Coxeter "
+  *out << "CoxIter is a program to compute invariants of hyperbolic Coxeter "
           "groups\n\n"
           "The basis usage is as follows:\n\t./coxiter < "
           "file-describing-the-graph\n\n"
@@ -597,6 +1386,8 @@ void App::printHelp() const {
           "\t-fv : test whether the group has finite covolume\n"
           "\t-g  : growth series\n"
           "\t-gr : growth rate\n"
+          "\t-gr-threshold T : test whether the growth rate is >= T\n"
+          "\t-gr-bounds : interval which contains the growth rate\n"
           "\t-s  : signature\n\n"
           "There are many more options regarding the format of the output and "
           "the possible computations.\nThe full documentation is available "
@@ -32,10 +32,17 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 #define APP_H
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <vector>
 
+#include <dirent.h>
+#include <sys/stat.h>
 #ifdef WIN32
 #include <io.h>
 #else
@@ -52,6 +59,42 @@ using namespace std;
 #include "arithmeticity.h"
 #include "coxiter.h"
 #include "index2.h"
+#include "lib/json.h"
+#include "resultscache.h"
+
+/*! \struct App_Result
+ * \brief Results of the computations for one graph (see
+ * App::computeInvariants)
+ */
+struct App_Result {
+  bool isEulerSuccess; ///< False if the Euler characteristic cannot be computed
+  bool isCanBeFiniteCovolumeComputed; ///< If canBeFiniteCovolume is known
+  bool canBeFiniteCovolume;           ///< Can the group be of finite covolume?
+  bool isSignatureComputed;           ///< If signature is known
+  array<unsigned int, 3> signature;   ///< Signature of the Gram matrix
+  int growthRateComparison; ///< Growth rate >= threshold (1: yes, 0: no, -1: ?)
+  bool isGrowthRateBoundsComputed; ///< If the following two are known
+  mpq_class growthRateLower;       ///< Lower bound for the growth rate
+  mpq_class growthRateUpper;       ///< Upper bound for the growth rate
+#ifdef _COMPILE_WITH_PARI_
+  GrowthRate_Result grr; ///< Growth rate
+#endif
+  bool isCacheHit;        ///< If the invariants were found in the cache
+  string canonicalHash;   ///< Hash of the canonical form (hexadecimal)
+  vector<string> canonicalLabeling; ///< Vertices in the canonical order
+  double computationTime; ///< In seconds
+  vector<pair<string, double>> timings; ///< Time spent in each stage (seconds)
+  vector<string> errors; ///< Errors which were not displayed (batch mode)
+};
+
+/*! \struct App_BatchJob
+ * \brief One graph to be analysed in batch mode (see App::runBatchJobs)
+ */
+struct App_BatchJob {
+  string name;    ///< Name of the graph (in the output)
+  string path;    ///< Path to the file (if empty: content is used)
+  string content; ///< Content of the graph (text or binary)
+};
 
 class App {
 private:
@@ -65,16 +108,32 @@ private:
                                  ///< finite covolume or not
   bool computeGrowthSeries;      ///< If we want compute the growth series
   bool computeGrowthRate;        ///< If we want to compute the growth rate
+  bool checkGrowthRateThreshold; ///< If we want to compare the growth rate
+                                 ///< with growthRateThreshold
+  bool computeGrowthRateBounds;  ///< If we want an interval which contains the
+                                 ///< growth rate (without the growth series)
   bool computeEuler;       ///< If we want to compute the Euler characteristic
   bool computeSignature;   ///< If we want to compute the signature
   bool debug;              ///< Display additional information
   bool bIndex2;            ///< Trying to extract an index two subroup?
+  bool bBatch; ///< Many graphs (directory or concatenated files) are analysed
+  bool bJSONOutput; ///< Results in JSON (one object, on one line, per graph)
+  bool bStats;      ///< Display the timers and counters (see CoxIter_Stats)
+  bool bCanonical;  ///< Display the canonical hash and labeling of the graph
   bool useOpenMP;          ///< Use OpenMP
+  bool useSymmetries; ///< Enumerate the products up to the automorphisms
+  bool memoryBounded; ///< Memory-bounded mode (see CoxIter::set_memoryBounded)
+  bool streamedCheck; ///< Streamed check (see CoxIter::set_streamedCheck)
   bool printCoxeterGraph;  ///< Print the Coxeter graph?
   bool printCoxeterMatrix; ///< Print the Coxeter matrix?
   bool printGramMatrix;    ///< Print the Gram matrix?
   bool bPrintHelp; ///< If we want to print help (option or by default depending
                    ///< on the error)
+  unsigned int growthRatePrecision; ///< Number of digits of the growth rate
+  unsigned int growthRateRefinePrecision; ///< If positive, the growth rate is
+                                          ///< then refined to this number of
+                                          ///< digits (see GrowthRate::refine)
+  mpq_class growthRateThreshold; ///< Threshold for the growth rate
   string ouputMathematicalFormat;  ///< Format of output: generic,
                                    ///< mathematica, pari
   vector<string> verticesToRemove; ///< The vertices we want to remove
@@ -84,10 +143,25 @@ private:
   string index2vertex_s0; ///< If we want to compute the f-vector of the
                           ///< corresponding infinite sequence
 
+  vector<unique_ptr<CoxIter>> batchCoxIters; ///< One instance per thread
+  vector<unique_ptr<Arithmeticity>> batchArithmeticities; ///< Idem
+  mutex pariMutex; ///< PARI cannot be used by two threads at the same time
+#ifdef _COMPILE_WITH_PARI_
+  unique_ptr<Signature> signatureComputer; ///< Shared by the jobs (pariMutex)
+  unique_ptr<GrowthRate> growthRateComputer; ///< Idem
+#endif
+
+  string cacheFilename;      ///< Path to the cache (empty: no cache)
+  ResultsCache resultsCache; ///< Cache of the invariants
+
+  ostream *out; ///< Where the results are written (default: cout)
+
 public:
   bool bCoutFile;          ///< If the output is redirected to a file
   bool bOutputGraphToDraw; ///< If we write the graph in a file, to use graphviz
   bool bOutputGraph; ///< If we write the graph in a file, to use with CoxIter
+  bool bOutputBinaryGraph; ///< If we write the graph in the binary format
+  bool binaryInput;        ///< If the graph is given in the binary format
   string inFilename; ///< Path to the graph
   string outFilenameBasis; ///< Path to the file for the output (+ .output,
                            ///< .graphviz, .coxiter)
@@ -99,8 +173,107 @@ public:
   void run();
   void printHelp() const;
 
+  /*!	\fn set_output
+   * 	\brief Set the stream where the results are written (instead of cout)
+   * 	\param output(ostream&) The stream
+   */
+  void set_output(ostream &output);
+
 private:
   void extractIndex2Subgroup(CoxIter &ci);
+
+  /*!	\fn configureCoxIter
+   * 	\brief Give the options (checks, vertices, format) to a CoxIter instance
+   * 	\param ci(CoxIter&) The instance
+   */
+  void configureCoxIter(CoxIter &ci) const;
+
+  /*!	\fn computeInvariants
+   * 	\brief Do the computations asked for the graph read by ci
+   *
+   * 	\param ci(CoxIter&) The graph
+   * 	\param arithmeticity(Arithmeticity&) Used for the arithmeticity test
+   * 	\param result(App_Result&) The results
+   * 	\param verbose(const bool&) If true, the steps and the errors are
+   * displayed; otherwise the errors are stored in result
+   */
+  void computeInvariants(CoxIter &ci, Arithmeticity &arithmeticity,
+                         App_Result &result, const bool &verbose);
+
+  /*!	\fn runBatch
+   * 	\brief Analyse many graphs
+   *
+   * 	The input is either a directory (all the .coxiter, or .coxiterb with
+   * -binary, files) or a stream (file or stdin) of graphs. In a stream, the
+   * text graphs are separated by lines beginning with "---" (the remaining
+   * of the line is the name of the next graph) while the binary graphs are
+   * simply concatenated.
+   * 	The graphs are given by chunks to runBatchJobs.
+   */
+  void runBatch();
+
+  /*!	\fn batchChunkSize
+   * 	\brief Number of graphs read before they are analysed (batch mode)
+   * 	\return The size of a chunk
+   */
+  size_t batchChunkSize() const;
+
+  /*!	\fn runBatchJobs
+   * 	\brief Analyse a chunk of graphs and print the records in the order of
+   * the input
+   *
+   * 	With OpenMP, the small graphs are analysed in parallel (one graph per
+   * thread, one CoxIter instance per thread). The graphs with at least 15
+   * vertices, for which CoxIter uses itself several threads, are then
+   * analysed one after the other.
+   *
+   * 	\param jobs(const vector<App_BatchJob>&) The graphs
+   */
+  void runBatchJobs(const vector<App_BatchJob> &jobs);
+
+  /*!	\fn printRecord
+   * 	\brief Print the results for one graph, on one line (batch mode or
+   * -json)
+   *
+   * 	\param out(ostream&) Where to print
+   * 	\param name(const string&) Name of the graph
+   * 	\param ci(CoxIter&) The graph
+   * 	\param result(const App_Result&) The results
+   */
+  void printRecord(ostream &out, const string &name, CoxIter &ci,
+                   const App_Result &result);
+
+  /*!	\fn printRecordJSON
+   * 	\brief Print the results for one graph as a JSON object, on one line
+   * (see printRecord)
+   *
+   * 	\param out(ostream&) Where to print
+   * 	\param name(const string&) Name of the graph
+   * 	\param ci(CoxIter&) The graph
+   * 	\param result(const App_Result&) The results
+   */
+  void printRecordJSON(ostream &out, const string &name, CoxIter &ci,
+                       const App_Result &result);
+
+  /*!	\fn printErrorRecord
+   * 	\brief Print the record of a graph which cannot be read
+   *
+   * 	\param out(ostream&) Where to print
+   * 	\param name(const string&) Name of the graph
+   * 	\param error(const string&) The error
+   */
+  void printErrorRecord(ostream &out, const string &name, const string &error);
+
+  /*!	\fn growthRateBoundToString
+   * 	\brief Bound for the growth rate, with 15 decimals
+   *
+   * 	\param bound(const mpq_class&) The bound
+   * 	\param roundUp(const bool&) True for an upper bound (rounded up),
+   * false for a lower bound (rounded down)
+   * 	\return The bound (decimal number)
+   */
+  string growthRateBoundToString(const mpq_class &bound,
+                                 const bool &roundUp) const;
 };
 
 #endif // APP_H
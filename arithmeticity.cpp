@@ -22,6 +22,22 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include "arithmeticity.h"
 
+bool CycleRecord::operator==(const CycleRecord &c) const {
+  return (twoCount == c.twoCount && sqrt2Count == c.sqrt2Count &&
+          sqrt3Count == c.sqrt3Count && dottedEdges == c.dottedEdges);
+}
+
+size_t CycleRecordHash::operator()(const CycleRecord &c) const {
+  size_t h(c.twoCount);
+  h = h * 31 + c.sqrt2Count;
+  h = h * 31 + c.sqrt3Count;
+
+  for (const auto &edge : c.dottedEdges)
+    h = h * 31 + edge;
+
+  return h;
+}
+
 Arithmeticity::Arithmeticity()
     : verticesCount(0), notArithmetic(false), ci(0), listCycles(false) {}
 
@@ -30,12 +46,28 @@ Arithmeticity::~Arithmeticity() {}
 void Arithmeticity::test(CoxIter &ci_, const bool &listCycles_) {
   ci = &ci_;
   listCycles = listCycles_;
-  allCycles.clear();
+  cycles.clear();
+  error = "";
+
+  ci->computeCyclicProducts();
+
+  // ------------------------------------------------------
+  // If the cyclic products lie in Z, the group is arithmetic (cocompact or not)
+  if (ci->get_cyclicProductsField() == "Q") {
+    ci->set_isArithmetic(1);
+    return;
+  }
+
   if (ci->get_isCocompact() !=
       0) // If the graph is cocompact (1) or if we don't know (-1)
   {
-    error = "GROUP COCOMPACTNESS";
-    ci->set_isArithmetic(-1);
+    if (ci->get_isCocompact() == 1 && !ci->get_hasDottedLine())
+      testGaloisConjugates();
+    else {
+      error = "GROUP COCOMPACTNESS";
+      ci->set_isArithmetic(-1);
+    }
+
     return;
   }
 
@@ -49,62 +81,48 @@ void Arithmeticity::test(CoxIter &ci_, const bool &listCycles_) {
 
   // ------------------------------------------------------
   // Cycles consisting of two elements
-  bool isSqrt2(false), isSqrt3(false);
-
   for (i = 0; i < verticesCount; i++) {
     referencesToLabels.push_back(i);
 
     for (j = 0; j < i; j++) {
-      if (i == j)
-        continue;
-
       if (coxeterMatrix[i][j] != 1 && coxeterMatrix[i][j] != 0 &&
           coxeterMatrix[i][j] != 2 && coxeterMatrix[i][j] != 3 &&
           coxeterMatrix[i][j] != 4 && coxeterMatrix[i][j] != 6) {
         if (ci->get_debug())
-          cout << "\tNot arithmetic: 2*G(" << ci->get_vertexLabel(i) << ","
-               << ci->get_vertexLabel(j) << ") = pi/" << coxeterMatrix[i][j]
-               << endl;
+          ci->get_output() << "\tNot arithmetic: 2*G("
+                           << ci->get_vertexLabel(i) << ","
+                           << ci->get_vertexLabel(j)
+                           << ") = pi/" << coxeterMatrix[i][j] << endl;
 
         ci->set_isArithmetic(0);
         return;
       }
 
-      if (coxeterMatrix[i][j] == 4)
-        isSqrt2 = true;
-      else if (coxeterMatrix[i][j] == 6)
-        isSqrt3 = true;
-      else if (coxeterMatrix[i][j] == 1) {
-        string cycle("4 * " + string("l") + to_string(j) + "m" + to_string(i) +
-                     "^2");
-
-        auto it(lower_bound(allCycles.begin(), allCycles.end(), cycle));
-        if (it == allCycles.end() || *it != cycle)
-          allCycles.insert(it, cycle);
+      if (coxeterMatrix[i][j] == 1) {
+        CycleRecord cycle = {0, 0, 0, vector<unsigned int>(2)};
+        cycle.dottedEdges[0] = cycle.dottedEdges[1] =
+            linearizationMatrix_index(j, i, verticesCount);
+        cycles.insert(cycle);
       }
     }
   }
 
   // ------------------------------------------------------
   // Here, we know that m_{ij} \in {2,3,4,6,infty}
+  testFundamentalCycles();
 
-  // If true, the group is arithmetic
-  if (!isSqrt2 && !isSqrt3 && !ci->get_hasDottedLine()) {
+  if (notArithmetic)
+    ci->set_isArithmetic(0);
+  else if (!ci->get_hasDottedLine())
     ci->set_isArithmetic(1);
-    return;
-  }
-
-  while (collapseQueues() && verticesCount)
-    ;
-
-  if (verticesCount <= 2) {
-    ci->set_isArithmetic(1);
-    return;
-  }
-
-  testCycles();
+  else if (listCycles) // Only the cycles with dotted edges remain to be listed
+  {
+    while (collapseQueues() && verticesCount)
+      ;
 
-  return;
+    testCycles();
+  } else
+    ci->set_isArithmetic(-1);
 }
 
 unsigned int Arithmeticity::collapseQueues() {
@@ -196,57 +214,190 @@ unsigned int Arithmeticity::collapseQueues() {
   return verticesToRemove.size();
 }
 
-void Arithmeticity::testCycles() {
-  for (unsigned int i(0); i < verticesCount; i++) {
-    path.clear();
-    visitedVertices = vector<bool>(verticesCount, false);
-    visitedEdges =
-        vector<vector<bool>>(verticesCount, vector<bool>(verticesCount, false));
-    findCycles(i, i);
-
-    if (notArithmetic) {
+void Arithmeticity::testFundamentalCycles() {
+  for (const auto &cyclicProduct : ci->get_cyclicProducts()) {
+    auto sqrt2(cyclicProduct.orders.find(4)),
+        sqrt3(cyclicProduct.orders.find(6));
+
+    if ((sqrt2 != cyclicProduct.orders.end() && sqrt2->second % 2) ||
+        (sqrt3 != cyclicProduct.orders.end() && sqrt3->second % 2)) {
+      notArithmetic = true;
+
+      if (ci->get_debug()) {
+        ci->get_output() << "\tNot arithmetic\n\t\tCycle: ";
+        for (vector<unsigned int>::const_iterator it(
+                 cyclicProduct.cycle.begin());
+             it != cyclicProduct.cycle.end(); ++it)
+          ci->get_output() << (it == cyclicProduct.cycle.begin() ? "" : ", ")
+                           << ci->get_vertexLabel(*it);
+        ci->get_output() << endl;
+      }
+
+      return;
+    }
+  }
+}
+
+void Arithmeticity::testGaloisConjugates() {
+  const long double pi(acosl(-1.0L));
+  const auto cyclicProducts(ci->get_cyclicProducts());
+  unsigned int i, j, k;
+
+  coxeterMatrix = ci->get_coxeterMatrix();
+  verticesCount = ci->get_verticesCount();
+
+  // ------------------------------------------------------
+  // Weights of the graph and their lcm
+  vector<unsigned int> orders;
+  unsigned int ordersLcm(1);
+
+  for (i = 0; i < verticesCount; i++) {
+    for (j = 0; j < i; j++) {
+      if (coxeterMatrix[i][j] >= 3 &&
+          find(orders.begin(), orders.end(), coxeterMatrix[i][j]) ==
+              orders.end()) {
+        orders.push_back(coxeterMatrix[i][j]);
+        ordersLcm = (ordersLcm / ugcd(ordersLcm, coxeterMatrix[i][j])) *
+                    coxeterMatrix[i][j];
+      }
+    }
+  }
+
+  auto isEqual = [](const long double &a, const long double &b) {
+    return fabsl(a - b) <= 1e-12L * max(1.0L, max(fabsl(a), fabsl(b)));
+  };
+
+  /*
+   * The embeddings of the field generated by the entries of the Gram matrix
+   * are given by cos(pi/m) -> cos(k * pi/m), with k odd and prime to the
+   * weights. The conjugates for k and 2 * ordersLcm - k are the same.
+   */
+  set<vector<unsigned int>> conjugatesTested;
+  for (k = 3; k < ordersLcm; k += 2) {
+    if (ugcd(k, ordersLcm) != 1)
+      continue;
+
+    vector<unsigned int> residues;
+    for (const auto &order : orders)
+      residues.push_back(min(k % (2 * order), 2 * order - k % (2 * order)));
+
+    if (!conjugatesTested.insert(residues).second)
+      continue;
+
+    // Is the embedding the identity on the field of the cyclic products?
+    bool isIdentity(true);
+
+    for (const auto &order : orders) {
+      if (!isEqual(cosl(pi / order) * cosl(pi / order),
+                   cosl(k * pi / order) * cosl(k * pi / order))) {
+        isIdentity = false;
+        break;
+      }
+    }
+
+    for (vector<CyclicProduct>::const_iterator it(cyclicProducts.begin());
+         isIdentity && it != cyclicProducts.end(); ++it) {
+      long double product(1), conjugate(1);
+
+      for (const auto &order : it->orders) {
+        if (order.first < 3)
+          continue;
+
+        product *= powl(2 * cosl(pi / order.first), order.second);
+        conjugate *= powl(2 * cosl(k * pi / order.first), order.second);
+      }
+
+      isIdentity = isEqual(product, conjugate);
+    }
+
+    if (isIdentity)
+      continue;
+
+    // The conjugate of the Gram matrix has to be positive semi-definite
+    if (ci->gramMatrixSignature(k)[1]) {
+      if (ci->get_debug())
+        ci->get_output()
+            << "\tNot arithmetic: the conjugate cos(pi/m) -> cos(" << k
+            << "*pi/m) of the Gram matrix is not positive semi-definite"
+            << endl;
+
       ci->set_isArithmetic(0);
       return;
     }
   }
 
-  if (!ci->get_hasDottedLine())
+  ci->set_isArithmetic(1);
+}
+
+void Arithmeticity::testCycles() {
+  unsigned int root;
+
+#pragma omp parallel if (ci->get_useOpenMP() && verticesCount >= 6)
+  {
+#pragma omp single nowait
+    for (root = 0; root < verticesCount; root++) {
+#pragma omp task firstprivate(root)
+      {
+        vector<unsigned int> path;
+        vector<vector<bool>> visitedEdges(verticesCount,
+                                          vector<bool>(verticesCount, false));
+        unordered_set<CycleRecord, CycleRecordHash> cyclesFound;
+
+        bool isArithmetic(
+            findCycles(root, root, path, visitedEdges, cyclesFound));
+
+#pragma omp critical
+        {
+          if (!isArithmetic)
+            notArithmetic = true;
+          else
+            cycles.insert(cyclesFound.begin(), cyclesFound.end());
+        }
+      }
+    }
+  }
+
+  if (notArithmetic)
+    ci->set_isArithmetic(0);
+  else if (!ci->get_hasDottedLine())
     ci->set_isArithmetic(1);
   else
     ci->set_isArithmetic(-1);
 }
 
-void Arithmeticity::findCycles(const unsigned int &root,
-                               const unsigned int &from) {
+bool Arithmeticity::findCycles(
+    const unsigned int &root, const unsigned int &from,
+    vector<unsigned int> &path, vector<vector<bool>> &visitedEdges,
+    unordered_set<CycleRecord, CycleRecordHash> &cyclesFound) {
   path.push_back(root); // We add the vertex to the path
 
   for (unsigned int i(path[0]); i < verticesCount; i++) {
     // If i is a neighbour and if we did not visit this edge
     if (coxeterMatrix[root][i] != 2 && !visitedEdges[root][i]) {
       if (i == path[0]) {
-        if (path[1] <
-            path[path.size() - 1]) // We do not to test each cycle twice
-          testCycle();
-
-        if (notArithmetic) {
+        // We do not to test each cycle twice
+        if (path[1] < path[path.size() - 1] && !testCycle(path, cyclesFound)) {
           if (ci->get_debug()) {
-            cout << "\tNot arithmetic\n\t\tCycle: ";
-            for (vector<unsigned int>::const_iterator it(path.begin());
-                 it != path.end();
-                 ++it) // We display the components of the cycle
-              cout << (it == path.begin() ? "" : ", ")
-                   << ci->get_vertexLabel(referencesToLabels[*it]);
-            cout << endl;
+#pragma omp critical
+            {
+              ci->get_output() << "\tNot arithmetic\n\t\tCycle: ";
+              for (vector<unsigned int>::const_iterator it(path.begin());
+                   it != path.end();
+                   ++it) // We display the components of the cycle
+                ci->get_output()
+                    << (it == path.begin() ? "" : ", ")
+                    << ci->get_vertexLabel(referencesToLabels[*it]);
+              ci->get_output() << endl;
+            }
           }
 
-          return;
+          return false;
         }
       } else if (find(path.begin(), path.end(), i) == path.end()) {
         visitedEdges[root][i] = visitedEdges[i][root] = true;
-        findCycles(i, root);
 
-        if (notArithmetic)
-          return;
+        if (!findCycles(i, root, path, visitedEdges, cyclesFound))
+          return false;
       }
     }
   }
@@ -255,100 +406,96 @@ void Arithmeticity::findCycles(const unsigned int &root,
     visitedEdges[root][from] = visitedEdges[from][root] = false;
 
   path.pop_back();
+
+  return true;
 }
 
-void Arithmeticity::testCycle() {
+bool Arithmeticity::testCycle(
+    const vector<unsigned int> &path,
+    unordered_set<CycleRecord, CycleRecordHash> &cyclesFound) const {
   unsigned int pathSize(path.size());
-
-  if (!listCycles) {
-    bool isSqrt2CountEven = coxeterMatrix[path[0]][path[pathSize - 1]] != 4;
-    bool isSqrt3CountEven = coxeterMatrix[path[0]][path[pathSize - 1]] != 6;
-
-    for (unsigned int i(1); i < pathSize; i++) {
-      if (coxeterMatrix[path[i]][path[i - 1]] == 4)
-        isSqrt2CountEven = isSqrt2CountEven ? false : true;
-      else if (coxeterMatrix[path[i]][path[i - 1]] == 6)
-        isSqrt3CountEven = isSqrt3CountEven ? false : true;
-      else if (coxeterMatrix[path[i]][path[i - 1]] ==
-               1) // Because of the dotted line we cannot say anything for this
-                  // cycle
-        return;
+  unsigned int originalVerticesCount(ci->get_verticesCount());
+  CycleRecord cycle = {0, 0, 0, vector<unsigned int>(0)};
+
+  for (unsigned int i(0); i < pathSize; i++) {
+    unsigned int v(path[i]), w(path[i ? i - 1 : pathSize - 1]);
+
+    if (coxeterMatrix[v][w] == 0)
+      cycle.twoCount++;
+    else if (coxeterMatrix[v][w] == 4)
+      cycle.sqrt2Count++;
+    else if (coxeterMatrix[v][w] == 6)
+      cycle.sqrt3Count++;
+    else if (coxeterMatrix[v][w] == 1) {
+      // Because of the dotted line we cannot say anything for this cycle
+      if (!listCycles)
+        return true;
+
+      cycle.dottedEdges.push_back(linearizationMatrix_index(
+          min(referencesToLabels[v], referencesToLabels[w]),
+          max(referencesToLabels[v], referencesToLabels[w]),
+          originalVerticesCount));
     }
+  }
 
-    // Because of the dotted line we cannot say anything for this cycle
-    if (coxeterMatrix[path[0]][path[pathSize - 1]] == 1)
-      return;
+  if (cycle.dottedEdges.empty())
+    return !(cycle.sqrt2Count % 2) && !(cycle.sqrt3Count % 2);
 
-    notArithmetic = !isSqrt2CountEven || !isSqrt3CountEven;
-  } else {
-    unsigned int pathSize(path.size());
-
-    int dottedCount(coxeterMatrix[path[0]][path[pathSize - 1]] == 1 ? 1 : 0);
-    int twoCount(coxeterMatrix[path[0]][path[pathSize - 1]] == 0 ? 1 : 0);
-    int sqrt2Count(coxeterMatrix[path[0]][path[pathSize - 1]] == 4 ? 1 : 0);
-    int sqrt3Count(coxeterMatrix[path[0]][path[pathSize - 1]] == 6 ? 1 : 0);
-
-    for (unsigned int i(1); i < pathSize; i++) {
-      if (coxeterMatrix[path[i]][path[i - 1]] == 0)
-        twoCount++;
-      else if (coxeterMatrix[path[i]][path[i - 1]] == 4)
-        sqrt2Count++;
-      else if (coxeterMatrix[path[i]][path[i - 1]] == 6)
-        sqrt3Count++;
-      else if (coxeterMatrix[path[i]][path[i - 1]] ==
-               1) // Because of the dotted line we cannot say anything for this
-                  // cycle
-        dottedCount++;
-    }
+  sort(cycle.dottedEdges.begin(), cycle.dottedEdges.end());
+  cyclesFound.insert(cycle);
 
-    if (dottedCount == 0)
-      notArithmetic = (sqrt2Count % 2) || (sqrt3Count % 2);
-    else {
-      string temp;
+  return true;
+}
 
-      twoCount += dottedCount;
+string Arithmeticity::cycleToString(const CycleRecord &cycle) const {
+  unsigned int originalVerticesCount(ci->get_verticesCount());
+  string str;
 
-      if (sqrt2Count > 1)
-        twoCount += ((sqrt2Count % 2) ? sqrt2Count - 1 : sqrt2Count) / 2;
+  // Cycle consisting of two elements linked by a dotted edge
+  if (cycle.dottedEdges.size() == 2 &&
+      cycle.dottedEdges[0] == cycle.dottedEdges[1])
+    return "4 * l" +
+           to_string(linearizationMatrix_row(cycle.dottedEdges[0],
+                                             originalVerticesCount)) +
+           "m" +
+           to_string(linearizationMatrix_col(cycle.dottedEdges[0],
+                                             originalVerticesCount)) +
+           "^2";
 
-      if (twoCount)
-        temp += (temp == "" ? "" : " * ") + string("2^") + to_string(twoCount);
+  unsigned int twoCount(cycle.twoCount + cycle.dottedEdges.size() +
+                        cycle.sqrt2Count / 2);
 
-      if (sqrt3Count > 1)
-        temp += (temp == "" ? "" : " * ") + string("3^") +
-                to_string(((sqrt2Count % 2) ? sqrt2Count - 1 : sqrt2Count) / 2);
+  if (twoCount)
+    str += string("2^") + to_string(twoCount);
 
-      if (sqrt2Count % 2)
-        temp += (temp == "" ? "" : " * ") + string("Sqrt[2]");
+  if (cycle.sqrt3Count > 1)
+    str += (str == "" ? "" : " * ") + string("3^") +
+           to_string(cycle.sqrt3Count / 2);
 
-      if (sqrt3Count % 2)
-        temp += (temp == "" ? "" : " * ") + string("Sqrt[3]");
+  if (cycle.sqrt2Count % 2)
+    str += (str == "" ? "" : " * ") + string("Sqrt[2]");
 
-      for (unsigned int i(1); i < pathSize; i++) {
-        if (coxeterMatrix[path[i]][path[i - 1]] == 1)
-          temp += (temp == "" ? "" : " * ") + string("l") +
-                  to_string(min(referencesToLabels[path[i]],
-                                referencesToLabels[path[i - 1]])) +
-                  "m" +
-                  to_string(max(referencesToLabels[path[i]],
-                                referencesToLabels[path[i - 1]]));
-      }
+  if (cycle.sqrt3Count % 2)
+    str += (str == "" ? "" : " * ") + string("Sqrt[3]");
 
-      if (coxeterMatrix[path[0]][path[pathSize - 1]] == 1)
-        temp += (temp == "" ? "" : " * ") + string("l") +
-                to_string(min(referencesToLabels[path[0]],
-                              referencesToLabels[path[pathSize - 1]])) +
-                "m" +
-                to_string(max(referencesToLabels[path[0]],
-                              referencesToLabels[path[pathSize - 1]]));
-
-      const auto it(lower_bound(allCycles.begin(), allCycles.end(), temp));
-      if (it == allCycles.end() || *it != temp)
-        allCycles.insert(it, temp);
-    }
-  }
+  for (const auto &edge : cycle.dottedEdges)
+    str += (str == "" ? "" : " * ") + string("l") +
+           to_string(linearizationMatrix_row(edge, originalVerticesCount)) +
+           "m" +
+           to_string(linearizationMatrix_col(edge, originalVerticesCount));
+
+  return str;
 }
 
-vector<string> Arithmeticity::get_allCycles() { return allCycles; }
+vector<string> Arithmeticity::get_allCycles() {
+  vector<string> allCycles;
+
+  for (const auto &cycle : cycles)
+    allCycles.push_back(cycleToString(cycle));
+
+  sort(allCycles.begin(), allCycles.end());
+
+  return allCycles;
+}
 
 string Arithmeticity::get_error() { return error; }
@@ -25,8 +25,10 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
  * \author Rafael Guglielmetti
  *
  * \class Arithmeticity
- * \brief This class tests the arithmeticity of a graph which has no dotted edge
- * and which is non-cocompact. It uses Vinberg's criteria.
+ * \brief This class tests the arithmeticity of a graph. It uses Vinberg's
+ * criteria.
+ *
+ * For cocompact groups, the graph cannot contain dotted edges.
  */
 
 #ifndef ARITHMETICITY_H
@@ -34,6 +36,25 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include "coxiter.h"
 
+/*! \struct CycleRecord
+ * \brief Compact description of a cycle which has to be tested manually
+ *
+ * The cycle is rendered as a string only when the list of cycles is asked
+ */
+struct CycleRecord {
+  unsigned int twoCount;   ///< Number of bold edges
+  unsigned int sqrt2Count; ///< Number of edges with weight 4
+  unsigned int sqrt3Count; ///< Number of edges with weight 6
+  vector<unsigned int>
+      dottedEdges; ///< Dotted edges (linearized indices, sorted)
+
+  bool operator==(const CycleRecord &c) const;
+};
+
+struct CycleRecordHash {
+  size_t operator()(const CycleRecord &c) const;
+};
+
 class Arithmeticity {
 private:
   string error; ///< If an error occured, small text.
@@ -44,16 +65,11 @@ private:
   vector<unsigned int> referencesToLabels;    ///< Correspondence for the new
                                               ///< indices to the old ones
 
-  // For the DFS
-  vector<vector<bool>> visitedEdges; ///< Traversed edges
-  vector<bool> visitedVertices;      ///<  Taversed vertices
-  vector<unsigned int> path;         ///< Current path
-
   bool notArithmetic; ///< True if not arithmetic (i.e. we have to quit the
                       ///< algorithm)
 
   bool listCycles; ///< If true, will list the cycles to be manually tested
-  vector<string> allCycles; ///< The list
+  unordered_set<CycleRecord, CycleRecordHash> cycles; ///< The list
 
 public:
   /*! \fn Arithmeticity()
@@ -100,9 +116,31 @@ private:
 
   /*! 	\fn testCycles
    * 	\brief Test the cycles
+   *
+   * 	One task is created for each starting vertex of the DFS
    */
   void testCycles();
 
+  /*! 	\fn testFundamentalCycles
+   * 	\brief Test the cycles which do not contain dotted edges
+   *
+   * 	The parities of the numbers of edges with weight 4 and 6 are additive
+   * over GF(2). Hence, it is sufficient to test a basis of the cycle space:
+   * the fundamental cycles computed by CoxIter::computeCyclicProducts.
+   * Eventually, set notArithmetic to true
+   */
+  void testFundamentalCycles();
+
+  /*! 	\fn testGaloisConjugates
+   * 	\brief Test of the arithmeticity of a cocompact group
+   *
+   * 	For every embedding of the field generated by the entries of the Gram
+   * matrix which is not the identity on the field generated by the cyclic
+   * products, the conjugate of the Gram matrix has to be positive
+   * semi-definite. The graph cannot contain dotted edges.
+   */
+  void testGaloisConjugates();
+
   /*! \fn findCycles
    * 	\brief Look for cycles
    *
@@ -111,23 +149,38 @@ private:
    * 	\param root(unsigned int&) Starting vertex
    * 	\param from(unsigned int&) Previoud vertex (if recursive call); root
    * otherwise
+   * 	\param path(vector<unsigned int>&) Current path
+   * 	\param visitedEdges(vector<vector<bool>>&) Traversed edges
+   * 	\param cyclesFound(unordered_set<CycleRecord, CycleRecordHash>&) Cycles
+   * to be tested manually
+   * 	\return False if the group is not arithmetic, true otherwise
    */
-  void findCycles(const unsigned int &root, const unsigned int &from);
+  bool findCycles(const unsigned int &root, const unsigned int &from,
+                  vector<unsigned int> &path,
+                  vector<vector<bool>> &visitedEdges,
+                  unordered_set<CycleRecord, CycleRecordHash> &cyclesFound);
 
   /*! \fn testCycle
    * 	\brief Test the cycle in path
    *
-   * 	This function is called by findCycles. Eventually, set notArithmetic to
-   * true
+   * 	This function is called by findCycles.
+   *
+   * 	\param path(vector<unsigned int>&) The cycle
+   * 	\param cyclesFound(unordered_set<CycleRecord, CycleRecordHash>&) Cycles
+   * to be tested manually
+   * 	\return False if the group is not arithmetic, true otherwise
    */
-  void testCycle();
-};
+  bool
+  testCycle(const vector<unsigned int> &path,
+            unordered_set<CycleRecord, CycleRecordHash> &cyclesFound) const;
 
-struct CycleElement {
-  unsigned int first;
-  unsigned int second;
+  /*! \fn cycleToString
+   * 	\brief Render a cycle
+   *
+   * 	\param cycle(CycleRecord&) The cycle
+   * 	\return The value which has to lie in Z (string)
+   */
+  string cycleToString(const CycleRecord &cycle) const;
 };
 
-struct Cycles {};
-
 #endif // ARITHMETICITY_H
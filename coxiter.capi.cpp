@@ -0,0 +1,195 @@
+/*
+Copyright (C) 2013-2017
+Rafael Guglielmetti, rafael.guglielmetti@unifr.ch
+*/
+
+/*
+This file is part of CoxIter.
+
+CoxIter is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+CoxIter is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "coxiter.capi.h"
+#include "coxiter.h"
+
+#include <cstring>
+#include <new>
+
+struct coxiter_graph {
+  CoxIter ci;
+  CoxIter_Results results; ///< Results of the last coxiter_run
+  string error;            ///< Last error
+  bool isGraphRead;        ///< False if the matrix is invalid
+};
+
+namespace {
+/*!	\fn copyString
+ * 	\brief Copy a string in a buffer of the caller (see coxiter.capi.h)
+ */
+size_t copyString(const string &str, char *buffer, const size_t &size) {
+  if (buffer && size) {
+    const size_t length(min(str.size(), size - 1));
+    memcpy(buffer, str.c_str(), length);
+    buffer[length] = '\0';
+  }
+
+  return str.size();
+}
+
+/*!	\fn copyVector
+ * 	\brief Copy a vector in a buffer of the caller (see coxiter.capi.h)
+ */
+size_t copyVector(const vector<unsigned int> &v, unsigned int *buffer,
+                  const size_t &size) {
+  if (buffer)
+    copy(v.begin(), v.begin() + min(v.size(), size), buffer);
+
+  return v.size();
+}
+} // namespace
+
+coxiter_graph *coxiter_create(const unsigned int *orders,
+                              unsigned int verticesCount,
+                              unsigned int dimension) {
+  coxiter_graph *graph(new (nothrow) coxiter_graph);
+  if (!graph)
+    return nullptr;
+
+  try {
+    vector<vector<unsigned int>> matrix(verticesCount,
+                                        vector<unsigned int>(verticesCount));
+    for (unsigned int i(0); i < verticesCount; i++)
+      copy(orders + i * verticesCount, orders + (i + 1) * verticesCount,
+           matrix[i].begin());
+
+    graph->ci.set_dimension(dimension);
+    graph->isGraphRead = graph->ci.readGraphFromMatrix(matrix);
+    if (!graph->isGraphRead)
+      graph->error = graph->ci.get_error();
+  } catch (const bad_alloc &) {
+    delete graph;
+    return nullptr;
+  } catch (const exception &ex) { // Nothing is thrown through the C interface
+    graph->isGraphRead = false;
+    graph->error = ex.what();
+  } catch (...) {
+    graph->isGraphRead = false;
+    graph->error = "Unknown error";
+  }
+
+  return graph;
+}
+
+void coxiter_destroy(coxiter_graph *graph) { delete graph; }
+
+int coxiter_run(coxiter_graph *graph, unsigned int flags) {
+  if (!graph)
+    return 0;
+
+  if (!graph->isGraphRead)
+    return 0; // The error of coxiter_create is kept
+
+  graph->error = "";
+
+  CoxIter_Analyses analyses;
+  analyses.eulerCharacteristic = flags & COXITER_EULER;
+  analyses.cocompactness = flags & COXITER_COCOMPACTNESS;
+  analyses.finiteCovolume = flags & COXITER_FINITE_COVOLUME;
+  analyses.canBeFiniteCovolume = flags & COXITER_CAN_BE_FINITE_COVOLUME;
+  analyses.growthSeries = flags & COXITER_GROWTH_SERIES;
+  analyses.arithmeticity = flags & COXITER_ARITHMETICITY;
+
+  // The options only hold for this call
+  graph->ci.set_useOpenMP(!(flags & COXITER_SEQUENTIAL));
+
+  graph->ci.set_memoryBounded(flags & COXITER_MEMORY_BOUNDED);
+  graph->ci.set_streamedCheck(flags & COXITER_STREAMED_CHECK);
+
+  try {
+    if (!graph->ci.analyse(analyses, graph->results)) {
+      graph->error = graph->ci.get_error();
+      return 0;
+    }
+  } catch (const exception &ex) { // Nothing is thrown through the C interface
+    graph->error = ex.what();
+    return 0;
+  } catch (...) {
+    graph->error = "Unknown error";
+    return 0;
+  }
+
+  return 1;
+}
+
+const char *coxiter_error(const coxiter_graph *graph) {
+  return graph ? graph->error.c_str() : "No graph";
+}
+
+int coxiter_get_results(const coxiter_graph *graph, coxiter_results *results) {
+  if (!graph || !results)
+    return 0;
+
+  const CoxIter_Results &r(graph->results);
+
+  results->dimension = r.dimension;
+  results->isDimensionGuessed = r.isDimensionGuessed;
+  results->isEulerCharacteristicComputed = r.isEulerCharacteristicComputed;
+  results->fVectorAlternateSum = r.fVectorAlternateSum;
+  results->verticesAtInfinityCount = r.verticesAtInfinityCount;
+  results->fVectorSize = r.fVector.size();
+  results->isCocompact = r.isCocompact;
+  results->isFiniteCovolume = r.isFiniteCovolume;
+  results->canBeFiniteCovolume = r.canBeFiniteCovolume;
+  results->isArithmetic = r.isArithmetic;
+  results->isGrowthSeriesComputed = r.isGrowthSeriesComputed;
+  results->growthSeries_isFractionReduced = r.growthSeries_isFractionReduced;
+
+  return 1;
+}
+
+size_t coxiter_get_fVector(const coxiter_graph *graph, unsigned int *buffer,
+                           size_t size) {
+  return graph ? copyVector(graph->results.fVector, buffer, size) : 0;
+}
+
+size_t coxiter_get_eulerCharacteristic(const coxiter_graph *graph,
+                                       char *buffer, size_t size) {
+  if (!graph)
+    return copyString("", buffer, size);
+
+  return copyString(graph->results.eulerCharacteristic.to_string(), buffer,
+                    size);
+}
+
+size_t coxiter_get_growthSeries_cyclotomicNumerator(
+    const coxiter_graph *graph, unsigned int *buffer, size_t size) {
+  return graph ? copyVector(graph->results.growthSeries_cyclotomicNumerator,
+                            buffer, size)
+               : 0;
+}
+
+size_t coxiter_get_growthSeries_polynomialDenominator(
+    const coxiter_graph *graph, char *buffer, size_t size) {
+  string coefficients;
+
+  if (graph) {
+    const vector<mpz_class> &denominator(
+        graph->results.growthSeries_polynomialDenominator);
+
+    for (size_t i(0); i < denominator.size(); i++)
+      coefficients += (i ? "," : "") + denominator[i].get_str();
+  }
+
+  return copyString(coefficients, buffer, size);
+}
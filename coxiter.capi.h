@@ -0,0 +1,176 @@
+/*
+Copyright (C) 2013-2017
+Rafael Guglielmetti, rafael.guglielmetti@unifr.ch
+*/
+
+/*
+This file is part of CoxIter.
+
+CoxIter is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+CoxIter is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*!
+ * \file coxiter.capi.h
+ * \author Rafael Guglielmetti
+ * \brief C interface to the CoxIter class (see CoxIter::analyse)
+ *
+ * A graph is created from its Coxeter matrix, given row by row (0 for a bold
+ * edge, 1 for a dotted edge, 2 if there is no edge). The computations are
+ * chosen with the COXITER_* flags. The results are then copied in buffers
+ * provided by the caller: the functions return the number of entries (or
+ * characters, without the final null character) of the complete result and
+ * write at most size of them, as snprintf.
+ *
+ * Different graphs can be analysed by different threads at the same time.
+ * A graph cannot be used by two threads at the same time.
+ *
+ * Example:
+ * 	coxiter_graph *g = coxiter_create(orders, 5, 4);
+ * 	if (coxiter_run(g, COXITER_EULER | COXITER_COCOMPACTNESS))
+ * 		coxiter_get_results(g, &results);
+ * 	coxiter_destroy(g);
+ */
+
+#ifndef __COXITER_CAPI_H__
+#define __COXITER_CAPI_H__ 1
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \brief Computations (see CoxIter_Analyses) */
+enum {
+  COXITER_EULER = 1,                  ///< Euler characteristic, f-vector
+  COXITER_COCOMPACTNESS = 2,          ///< Is the group cocompact?
+  COXITER_FINITE_COVOLUME = 4,        ///< Is the group of finite covolume?
+  COXITER_CAN_BE_FINITE_COVOLUME = 8, ///< Fast test of the infinite covolume
+  COXITER_GROWTH_SERIES = 16,         ///< Growth series
+  COXITER_ARITHMETICITY = 32,         ///< Is the group arithmetic?
+  COXITER_SEQUENTIAL = 64, ///< Do not use OpenMP during this call (e.g. if
+                           ///< the caller analyses several graphs in parallel)
+  COXITER_MEMORY_BOUNDED = 128, ///< See CoxIter::set_memoryBounded
+  COXITER_STREAMED_CHECK = 256  ///< See CoxIter::set_streamedCheck
+};
+
+/*! \struct coxiter_results
+ * \brief Results which have a fixed size (see CoxIter_Results)
+ */
+typedef struct {
+  unsigned int dimension; ///< Dimension (given or guessed)
+  int isDimensionGuessed; ///< If the dimension was guessed
+
+  int isEulerCharacteristicComputed;    ///< If the following four are known
+  int fVectorAlternateSum;              ///< Alternating sum of the f-vector
+  unsigned int verticesAtInfinityCount; ///< Number of vertices at infinity
+  unsigned int fVectorSize; ///< Number of components of the f-vector
+
+  int isCocompact;         ///< 1: yes, 0: no, -1: don't know, -2: not tested
+  int isFiniteCovolume;    ///< 1: yes, 0: no, -1: don't know, -2: not tested
+  int canBeFiniteCovolume; ///< 1: yes, 0: no, -2: not tested
+  int isArithmetic;        ///< 1: yes, 0: no, -1: don't know, -2: not tested
+
+  int isGrowthSeriesComputed;         ///< If the growth series is known
+  int growthSeries_isFractionReduced; ///< If the fraction is reduced
+} coxiter_results;
+
+typedef struct coxiter_graph coxiter_graph; ///< Opaque handle
+
+/*!	\fn coxiter_create
+ * 	\brief Create a graph from its Coxeter matrix
+ *
+ * 	\param orders(const unsigned int*) The verticesCount * verticesCount
+ * entries, row by row (the diagonal is not read)
+ * 	\param verticesCount(unsigned int) Number of vertices
+ * 	\param dimension(unsigned int) Dimension (0 if unknown)
+ * 	\return The graph (or NULL if the memory cannot be allocated). If the
+ * matrix is invalid, coxiter_error gives the reason
+ */
+coxiter_graph *coxiter_create(const unsigned int *orders,
+                              unsigned int verticesCount,
+                              unsigned int dimension);
+
+/*!	\fn coxiter_destroy
+ * 	\brief Free a graph (NULL is accepted)
+ */
+void coxiter_destroy(coxiter_graph *graph);
+
+/*!	\fn coxiter_run
+ * 	\brief Do the computations
+ *
+ * 	\param graph(coxiter_graph*) The graph
+ * 	\param flags(unsigned int) Combination of COXITER_* flags
+ * 	\return 1 if success, 0 otherwise (see coxiter_error)
+ */
+int coxiter_run(coxiter_graph *graph, unsigned int flags);
+
+/*!	\fn coxiter_error
+ * 	\brief Last error (empty string if none; cleared by coxiter_run, except
+ * if the matrix given to coxiter_create is invalid)
+ * 	\return The error, valid until the next call with this graph
+ */
+const char *coxiter_error(const coxiter_graph *graph);
+
+/*!	\fn coxiter_get_results
+ * 	\brief Copy the results of the last coxiter_run (only those of the
+ * computations asked in this call: the others are -2, or not computed)
+ * 	\param results(coxiter_results*) The results
+ * 	\return 1 if success, 0 otherwise
+ */
+int coxiter_get_results(const coxiter_graph *graph, coxiter_results *results);
+
+/*!	\fn coxiter_get_fVector
+ * 	\brief Copy the f-vector
+ * 	\param buffer(unsigned int*) Components
+ * 	\param size(size_t) Size of the buffer
+ * 	\return Number of components
+ */
+size_t coxiter_get_fVector(const coxiter_graph *graph, unsigned int *buffer,
+                           size_t size);
+
+/*!	\fn coxiter_get_eulerCharacteristic
+ * 	\brief Copy the Euler characteristic, as a string ("p/q", or "p" if it
+ * is an integer)
+ * 	\param buffer(char*) String
+ * 	\param size(size_t) Size of the buffer, including the null character
+ * 	\return Length of the string
+ */
+size_t coxiter_get_eulerCharacteristic(const coxiter_graph *graph,
+                                       char *buffer, size_t size);
+
+/*!	\fn coxiter_get_growthSeries_cyclotomicNumerator
+ * 	\brief Copy the indices of the cyclotomic polynomials of the numerator
+ * 	\param buffer(unsigned int*) Indices
+ * 	\param size(size_t) Size of the buffer
+ * 	\return Number of polynomials
+ */
+size_t coxiter_get_growthSeries_cyclotomicNumerator(
+    const coxiter_graph *graph, unsigned int *buffer, size_t size);
+
+/*!	\fn coxiter_get_growthSeries_polynomialDenominator
+ * 	\brief Copy the coefficients of the denominator, as a comma separated
+ * list (the coefficients can be big integers)
+ * 	\param buffer(char*) String
+ * 	\param size(size_t) Size of the buffer, including the null character
+ * 	\return Length of the string
+ */
+size_t coxiter_get_growthSeries_polynomialDenominator(
+    const coxiter_graph *graph, char *buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __COXITER_CAPI_H__
@@ -21,19 +21,47 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "coxiter.h"
+#include "arithmeticity.h"
+
+#include <chrono>
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+namespace {
+/*! \struct StageTimer
+ * \brief Adds to a timer the time elapsed between its creation and its
+ * destruction (monotonic clock)
+ */
+struct StageTimer {
+  double &seconds;
+  const chrono::steady_clock::time_point start;
+
+  StageTimer(double &seconds)
+      : seconds(seconds), start(chrono::steady_clock::now()) {}
+
+  ~StageTimer() {
+    seconds +=
+        chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  }
+};
+} // namespace
 
 CoxIter::CoxIter()
-    : checkCocompactness(false), checkCofiniteness(false), bCoutFile(false),
-      debug(false), isGramMatrixFieldKnown(false),
+    : checkCocompactness(false), checkCofiniteness(false), debug(false),
+      isGramMatrixFieldKnown(false), isCyclicProductsComputed(false),
       isGrowthSeriesComputed(false), hasBoldLine(false), hasDottedLine(false),
-      hasDottedLineWithoutWeight(0), bWriteInfo(false), isGraphExplored(false),
-      isGraphsProductsComputed(false), useOpenMP(true), brEulerCaracteristic(0),
+      hasDottedLineWithoutWeight(0), bWriteInfo(false), out(&cout),
+      isGraphExplored(false), isGraphsProductsComputed(false), useOpenMP(true),
+      useSymmetries(false), memoryBounded(false), streamedCheck(false),
+      isGraphsProductsIds(false), isCheckStreamed(false),
+      graphsProductsStreamedCount(), brEulerCaracteristic(0),
       graphsList_spherical(nullptr), graphsList_euclidean(nullptr),
-      dimension(0), euclideanMaxRankFound(0), sphericalMaxRankFound(0),
-      isDimensionGuessed(false), fVectorAlternateSum(0), isArithmetic(-1),
-      isCocompact(-2), isFiniteCovolume(-2), verticesAtInfinityCount(0),
-      verticesCount(0), outCout(0), sBufOld(0), error(""),
-      ouputMathematicalFormat("generic") {
+      isInfSeqInGraphsProducts(false), dimension(0), euclideanMaxRankFound(0),
+      sphericalMaxRankFound(0), isDimensionGuessed(false),
+      fVectorAlternateSum(0), isArithmetic(-1), isCocompact(-2),
+      isFiniteCovolume(-2), verticesAtInfinityCount(0), verticesCount(0),
+      error(""), ouputMathematicalFormat("generic"), stats() {
 #ifndef _OPENMP
   this->useOpenMP = false;
 #endif
@@ -41,27 +69,9 @@ CoxIter::CoxIter()
 
 CoxIter::CoxIter(const vector<vector<unsigned int>> &matrix,
                  const unsigned int &dimension)
-    : checkCocompactness(false), checkCofiniteness(false), bCoutFile(false),
-      isGramMatrixFieldKnown(false), isGraphExplored(false),
-      isGraphsProductsComputed(false), isGrowthSeriesComputed(false),
-      hasBoldLine(false), hasDottedLine(false), hasDottedLineWithoutWeight(0),
-      bWriteInfo(false), debug(false), useOpenMP(true), brEulerCaracteristic(0),
-      graphsList_spherical(nullptr), graphsList_euclidean(nullptr),
-      dimension(dimension), euclideanMaxRankFound(0), sphericalMaxRankFound(0),
-      isDimensionGuessed(false), fVectorAlternateSum(0), isCocompact(-2),
-      isFiniteCovolume(-2), verticesAtInfinityCount(0), verticesCount(0),
-      outCout(0), sBufOld(0), error(""), ouputMathematicalFormat("") {
-  verticesCount = matrix.size();
-
-  initializations();
-
-  coxeterMatrix = matrix;
-
-  maximalSubgraphRank = dimension ? dimension : verticesCount;
-
-#ifndef _OPENMP
-  this->useOpenMP = false;
-#endif
+    : CoxIter() {
+  this->dimension = dimension;
+  readGraphFromMatrix(matrix);
 }
 
 CoxIter::~CoxIter() {
@@ -70,12 +80,6 @@ CoxIter::~CoxIter() {
 
   if (graphsList_euclidean)
     delete graphsList_euclidean;
-
-  // if cout is redirected to a file
-  if (bCoutFile) {
-    outCout->close();
-    cout.rdbuf(sBufOld); // we restore the cout
-  }
 }
 
 bool CoxIter::bRunAllComputations() {
@@ -100,25 +104,226 @@ bool CoxIter::bRunAllComputations() {
   return true;
 }
 
-#ifndef _COMPILE_WITHOUT_REGEXP_
+bool CoxIter::analyse(const CoxIter_Analyses &analyses,
+                      CoxIter_Results &results) {
+  results = CoxIter_Results();
+
+  if (!coxeterMatrix.size()) {
+    error = "EMPTY_GRAPH";
+    return false;
+  }
+
+  // The lists needed by the tests are kept only if the flags are set: if the
+  // products were computed (previous call) without them, they are computed
+  // again
+  if (isGraphsProductsComputed &&
+      (((analyses.cocompactness || analyses.arithmeticity) &&
+        !checkCocompactness) ||
+       (analyses.finiteCovolume && !checkCofiniteness))) {
+    for (auto &counts : graphsProductsCount_spherical)
+      counts.clear();
+    for (auto &counts : graphsProductsCount_euclidean)
+      counts.clear();
+
+    sphericalMaxRankFound = euclideanMaxRankFound = 0;
+    if (isDimensionGuessed) {
+      dimension = 0;
+      isDimensionGuessed = false;
+    }
+
+    isGraphsProductsComputed = false;
+  }
+
+  if (analyses.cocompactness || analyses.arithmeticity)
+    checkCocompactness = true;
+  if (analyses.finiteCovolume)
+    checkCofiniteness = true;
+
+  try {
+    if (!isGraphExplored)
+      exploreGraph();
+
+    if (analyses.canBeFiniteCovolume)
+      results.canBeFiniteCovolume = canBeFiniteCovolume() ? 1 : 0;
+
+    if (analyses.eulerCharacteristic || analyses.cocompactness ||
+        analyses.finiteCovolume || analyses.growthSeries ||
+        analyses.arithmeticity)
+      computeGraphsProducts();
+
+    if (analyses.finiteCovolume)
+      checkCovolumeFiniteness();
+
+    if (analyses.eulerCharacteristic && !computeEulerCharacteristicFVector()) {
+      error = "Euler characteristic: check the graph encoding";
+      return false;
+    }
+
+    if (analyses.cocompactness || analyses.arithmeticity)
+      isGraphCocompact();
+
+    if (analyses.growthSeries)
+      growthSeries();
+
+    if (analyses.arithmeticity) {
+      Arithmeticity arithmeticity;
+      arithmeticity.test(*this, false);
+    }
+  } catch (const string &ex) {
+    error = ex;
+    return false;
+  }
+
+  const int canBeFiniteCovolume(results.canBeFiniteCovolume);
+  results = get_results();
+  results.isEulerCharacteristicComputed = analyses.eulerCharacteristic;
+  results.canBeFiniteCovolume = canBeFiniteCovolume;
+  if (analyses.arithmeticity)
+    results.isArithmetic = isArithmetic;
+
+  // The results of the previous calls which were not asked are not given
+  if (!analyses.eulerCharacteristic) {
+    results.eulerCharacteristic = 0;
+    results.fVector.clear();
+    results.fVectorAlternateSum = 0;
+    results.verticesAtInfinityCount = 0;
+  }
+
+  if (!analyses.cocompactness && !analyses.arithmeticity)
+    results.isCocompact = -2;
+
+  if (!analyses.finiteCovolume)
+    results.isFiniteCovolume = -2;
+
+  if (!analyses.growthSeries) {
+    results.isGrowthSeriesComputed = false;
+    results.growthSeries_cyclotomicNumerator.clear();
+    results.growthSeries_polynomialDenominator.clear();
+    results.growthSeries_isFractionReduced = false;
+  }
+
+  return true;
+}
+
+bool CoxIter::readGraphFromMatrix(const vector<vector<unsigned int>> &matrix,
+                                  const vector<string> &labels) {
+  resetGraph();
+
+  const unsigned int count(matrix.size());
+
+  for (unsigned int i(0); i < count; i++) {
+    if (matrix[i].size() != count) {
+      error = "The Coxeter matrix is not a square matrix";
+      return false;
+    }
+
+    for (unsigned int j(0); j < i; j++) {
+      if (matrix[i][j] != matrix[j][i]) {
+        error = "The Coxeter matrix is not symmetric";
+        return false;
+      }
+    }
+  }
+
+  if (labels.size()) {
+    if (labels.size() != count) {
+      error = "VERTICES_LABEL_COUNT";
+      return false;
+    }
+
+    for (unsigned int i(0); i < count; i++) {
+      map_vertices_labelToIndex[labels[i]] = i;
+      map_vertices_indexToLabel.push_back(labels[i]);
+    }
+
+    if (map_vertices_labelToIndex.size() != count) {
+      map_vertices_labelToIndex.clear();
+      map_vertices_indexToLabel.clear();
+      error = "VERTICES_LABEL_COUNT";
+      return false;
+    }
+  } else {
+    for (unsigned int i(0); i < count; i++) {
+      map_vertices_labelToIndex[to_string(i + 1)] = i;
+      map_vertices_indexToLabel.push_back(to_string(i + 1));
+    }
+  }
+
+  verticesCount = count;
+  initializations();
+
+  for (unsigned int i(0); i < verticesCount; i++) {
+    for (unsigned int j(0); j < i; j++) {
+      coxeterMatrix[i][j] = coxeterMatrix[j][i] = matrix[i][j];
+
+      if (matrix[i][j] == 1) // dotted, without weight
+      {
+        hasDottedLine = true;
+        hasDottedLineWithoutWeight = 1;
+      } else if (matrix[i][j] == 0)
+        hasBoldLine = true;
+    }
+  }
+
+  finalizeGraphReading();
+
+  return true;
+}
+
 bool CoxIter::parseGraph(istream &streamIn) {
-  string line;
-  PCRERegexp regexp;
-  PCREResult regexpRes;
+  resetGraph();
+
+  // The content is read at once; lines and tokens are pointers into it
+  const string content((istreambuf_iterator<char>(streamIn)),
+                       istreambuf_iterator<char>());
+  const char *contentEnd(content.data() + content.size());
+  const char *next(content.data()), *lineBegin, *lineEnd;
+
+  // Same behaviour as getline: the last line may not end with '\n'
+  auto getLine = [&next, &contentEnd, &lineBegin, &lineEnd]() -> bool {
+    if (next == contentEnd)
+      return false;
+
+    lineBegin = next;
+    lineEnd = find(next, contentEnd, '\n');
+    next = lineEnd == contentEnd ? contentEnd : lineEnd + 1;
+
+    return true;
+  };
+
+  auto isDigit = [](const char &c) -> bool {
+    return isdigit(static_cast<unsigned char>(c)) != 0;
+  };
+  auto isSpace = [](const char &c) -> bool {
+    return isspace(static_cast<unsigned char>(c)) != 0;
+  };
+  auto isLabelCharacter = [](const char &c) -> bool {
+    return isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '-';
+  };
 
   // loops variable, first vertice, second vertice, weight, number of vertices,
   // index of the current row
   unsigned int i, i1, i2, i3, verticesFileCount, rowIndex(1);
 
-  vector<unsigned int> orders; // orders found
-
   // ---------------------------------------------------------------------------
   // Reading the number of vertices and, eventually, dimension
-  if (getline(streamIn, line)) {
-    if (regexp.preg_match_all("([[:digit:]]+)[[:space:]]?([[:digit:]]*)", line,
-                              regexpRes) == 1) {
-      verticesFileCount = verticesCount = stoi(regexpRes[1][0]);
-      dimension = regexpRes[2][0] != "" ? stoi(regexpRes[2][0]) : 0;
+  if (getLine()) {
+    // Format: "([[:digit:]]+)[[:space:]]?([[:digit:]]*)", only once
+    const char *countBegin(find_if(lineBegin, lineEnd, isDigit));
+    const char *countEnd(find_if_not(countBegin, lineEnd, isDigit));
+    const char *dimensionBegin(countEnd);
+
+    if (dimensionBegin != lineEnd && isSpace(*dimensionBegin))
+      dimensionBegin++;
+
+    const char *dimensionEnd(find_if_not(dimensionBegin, lineEnd, isDigit));
+
+    if (countBegin != lineEnd &&
+        find_if(dimensionEnd, lineEnd, isDigit) == lineEnd) {
+      verticesFileCount = verticesCount = stoi(string(countBegin, countEnd));
+      dimension = dimensionBegin != dimensionEnd
+                      ? stoi(string(dimensionBegin, dimensionEnd))
+                      : 0;
     } else {
       error = "First line with number of vertices missing";
       return false;
@@ -130,15 +335,30 @@ bool CoxIter::parseGraph(istream &streamIn) {
 
   // ---------------------------------------------------------------------------
   // first line
-  if (!getline(streamIn, line)) {
+  if (!getLine()) {
     error = "EMPTY_FILE";
     return false;
   }
 
   // names of the vertices
-  if (regexp.preg_match_all("^vertices labels:[[:space:]]?([[:alnum:]-_ ]+)$",
-                            line, regexpRes)) {
-    vector<string> elements(explode(" ", regexpRes[1][0]));
+  // Format: "vertices labels:[[:space:]]?([[:alnum:]-_ ]+)"
+  const string labelsPrefix("vertices labels:");
+  const char *labelsBegin(lineBegin + labelsPrefix.size());
+  bool hasLabels(static_cast<size_t>(lineEnd - lineBegin) >
+                     labelsPrefix.size() &&
+                 equal(labelsPrefix.begin(), labelsPrefix.end(), lineBegin));
+
+  if (hasLabels) {
+    if (isSpace(*labelsBegin) && labelsBegin + 1 != lineEnd)
+      labelsBegin++;
+
+    hasLabels = all_of(labelsBegin, lineEnd, [&isLabelCharacter](char c) {
+      return isLabelCharacter(c) || c == ' ';
+    });
+  }
+
+  if (hasLabels) {
+    vector<string> elements(explode(" ", string(labelsBegin, lineEnd)));
     if (elements.size() != verticesFileCount) {
       error = "VERTICES_LABEL_COUNT";
       return false;
@@ -154,7 +374,7 @@ bool CoxIter::parseGraph(istream &streamIn) {
       return false;
     }
 
-    if (!getline(streamIn, line)) {
+    if (!getLine()) {
       error = "EMPTY_FILE";
       return false;
     }
@@ -173,17 +393,21 @@ bool CoxIter::parseGraph(istream &streamIn) {
                                      0); // Shifts for the removed vertices
   unsigned int truncCount(0);
 
+  // The member is kept as is, so that the next graph read is treated the same
+  vector<string> labelsToRemove(verticesToRemove);
   if (vertices.size()) // If we want to specify a subset of the vertices
   {
     auto allVertices(map_vertices_indexToLabel);
     sort(allVertices.begin(), allVertices.end());
 
     set_difference(allVertices.begin(), allVertices.end(), vertices.begin(),
-                   vertices.end(), std::back_inserter(verticesToRemove));
-    sort(verticesToRemove.begin(), verticesToRemove.end());
+                   vertices.end(), std::back_inserter(labelsToRemove));
+    sort(labelsToRemove.begin(), labelsToRemove.end());
+    labelsToRemove.erase(unique(labelsToRemove.begin(), labelsToRemove.end()),
+                         labelsToRemove.end());
   }
 
-  for (const auto &vertexToRemove : verticesToRemove) {
+  for (const auto &vertexToRemove : labelsToRemove) {
     if (vertexToRemove == "dotted" &&
         map_vertices_labelToIndex.find("dotted") ==
             map_vertices_labelToIndex.end()) // remove dotted edges?
@@ -206,35 +430,86 @@ bool CoxIter::parseGraph(istream &streamIn) {
   }
   verticesCount -= truncCount;
 
+  // Labels of the file (removed vertices included) -> index
+  unordered_map<string, unsigned int> labelsToIndices(
+      map_vertices_labelToIndex.begin(), map_vertices_labelToIndex.end());
+  vector<bool> isVertexRemoved(verticesFileCount, false);
+  for (const auto &vertexToRemove : labelsToRemove) {
+    auto it(labelsToIndices.find(vertexToRemove));
+    if (it != labelsToIndices.end())
+      isVertexRemoved[it->second] = true;
+  }
+
   // ---------------------------------------------------------------------------
   // initializations
   initializations(); // now that we know the real number of vertices
 
   // ---------------------------------------------------------------------------
   // reading the graph
+  string label1, label2, order; // Buffers reused for every row
   do {
-    regexpRes.clear();
-
-    // Usual row: "first vertice" "second vertice" "weight"
-    if (regexp.preg_match_all(
-            "([[:alnum:]_-]+)[[:space:]]([[:alnum:]_-]+)[[:space:]]([[:digit:]]"
-            "+)([[:space:]]+#[[:space:]]*([^\n]+))?",
-            line, regexpRes)) {
-      if (map_vertices_labelToIndex.find(regexpRes[1][0]) ==
-          map_vertices_labelToIndex.end()) {
-        error = "The following vertex is unknown: " + regexpRes[1][0];
+    /*
+     * Usual row: "first vertice" "second vertice" "weight"
+     * Format: ([[:alnum:]_-]+)[[:space:]]([[:alnum:]_-]+)[[:space:]]([[:digit:]]+)
+     *  ([[:space:]]+#[[:space:]]*([^\n]+))?
+     * The first occurrence in the row is taken.
+     */
+    const char *label1Begin(lineBegin), *label1End(lineBegin),
+        *label2Begin(lineBegin), *label2End(lineBegin), *orderBegin(lineBegin),
+        *orderEnd(lineBegin), *weightBegin(lineEnd);
+    bool isEdge(false);
+
+    for (const char *c(lineBegin); c != lineEnd && !isEdge;) {
+      if (!isLabelCharacter(*c)) {
+        c++;
+        continue;
+      }
+
+      label1Begin = c;
+      label1End = c = find_if_not(c, lineEnd, isLabelCharacter);
+      if (label1End == lineEnd || !isSpace(*label1End))
+        continue;
+
+      label2Begin = label1End + 1;
+      label2End = find_if_not(label2Begin, lineEnd, isLabelCharacter);
+      if (label2Begin == label2End || label2End == lineEnd ||
+          !isSpace(*label2End))
+        continue;
+
+      orderBegin = label2End + 1;
+      orderEnd = find_if_not(orderBegin, lineEnd, isDigit);
+      isEdge = orderBegin != orderEnd;
+    }
+
+    if (isEdge) {
+      // Weight of the dotted line?
+      const char *commentBegin(find_if_not(orderEnd, lineEnd, isSpace));
+      if (commentBegin != orderEnd && commentBegin != lineEnd &&
+          *commentBegin == '#') {
+        weightBegin = find_if_not(commentBegin + 1, lineEnd, isSpace);
+        if (weightBegin == lineEnd && weightBegin != commentBegin + 1)
+          weightBegin--; // The weight cannot be empty
+      }
+
+      label1.assign(label1Begin, label1End);
+      label2.assign(label2Begin, label2End);
+      order.assign(orderBegin, orderEnd);
+
+      auto itLabel1(labelsToIndices.find(label1));
+      if (itLabel1 == labelsToIndices.end()) {
+        error = "The following vertex is unknown: " + label1;
         return false;
       }
 
-      if (map_vertices_labelToIndex.find(regexpRes[2][0]) ==
-          map_vertices_labelToIndex.end()) {
-        error = "The following vertex is unknown: " + regexpRes[2][0];
+      auto itLabel2(labelsToIndices.find(label2));
+      if (itLabel2 == labelsToIndices.end()) {
+        error = "The following vertex is unknown: " + label2;
         return false;
       }
 
-      i1 = map_vertices_labelToIndex[regexpRes[1][0]];
-      i2 = map_vertices_labelToIndex[regexpRes[2][0]];
-      i3 = stoi(regexpRes[3][0]);
+      i1 = itLabel1->second;
+      i2 = itLabel2->second;
+      i3 = stoi(order);
 
       if (i3 == 1 && bRemoveDottedEdges)
         i3 = 2;
@@ -242,35 +517,26 @@ bool CoxIter::parseGraph(istream &streamIn) {
       rowIndex++;
 
       // Removed vertex?
-      if (binary_search(verticesToRemove.begin(), verticesToRemove.end(),
-                        regexpRes[1][0]) ||
-          binary_search(verticesToRemove.begin(), verticesToRemove.end(),
-                        regexpRes[2][0]))
+      if (isVertexRemoved[i1] || isVertexRemoved[i2])
         continue;
 
       // on tient compte du décalage lié à la troncation
       i1 -= verticesShift[i1];
       i2 -= verticesShift[i2];
 
-      // on garde le poids (pour corps engendré par les coefficients de la
-      // matrice de Gram)
-      if (find(orders.begin(), orders.end(), i3) == orders.end())
-        orders.push_back(i3);
-
       if (i3 == 1) // Weight of the dotted line given?
       {
-        if (regexpRes.size() > 5) {
+        if (weightBegin != lineEnd) {
           unsigned int index(linearizationMatrix_index(min(i1, i2), max(i1, i2),
                                                        verticesCount));
-          weightsDotted[index] = regexpRes[5][0];
+          weightsDotted[index] = string(weightBegin, lineEnd);
         } else
           hasDottedLineWithoutWeight = 1;
       }
 
       // si on avait déjà cette arête avec un ordre différent
       if (coxeterMatrix[i1][i2] != 2 && coxeterMatrix[i1][i2] != i3) {
-        error = "Edge has multiple orders (" + regexpRes[1][0] + "," +
-                regexpRes[2][0] + ")";
+        error = "Edge has multiple orders (" + label1 + "," + label2 + ")";
         return false;
       }
 
@@ -281,15 +547,15 @@ bool CoxIter::parseGraph(istream &streamIn) {
         hasDottedLine = true;
       else if (i3 == 0)
         hasBoldLine = true;
-    } else if (line != "") {
+    } else if (lineBegin != lineEnd) {
       if (bWriteInfo)
-        cout << "Unread line (incorrect format): "
-             << "#" << line << "#" << rowIndex << endl;
+        *out << "Unread line (incorrect format): "
+             << "#" << string(lineBegin, lineEnd) << "#" << rowIndex << endl;
 
       rowIndex++;
       continue;
     }
-  } while (getline(streamIn, line));
+  } while (getLine());
 
   // ---------------------------------------------------------------------------
   // Labels and co
@@ -306,1292 +572,3110 @@ bool CoxIter::parseGraph(istream &streamIn) {
     }
   }
 
+  finalizeGraphReading();
+
+  return true;
+}
+
+void CoxIter::finalizeGraphReading() {
   maximalSubgraphRank = dimension ? dimension : verticesCount;
 
   // ---------------------------------------------------------------------------
   // some information
   if (bWriteInfo) {
-    cout << "Reading graph: " << endl;
-    cout << "\tNumber of vertices: " << verticesCount << endl;
-    cout << "\tDimension: " << (dimension ? to_string(dimension) : "?") << endl;
+    *out << "Reading graph: " << endl;
+    *out << "\tNumber of vertices: " << verticesCount << endl;
+    *out << "\tDimension: " << (dimension ? to_string(dimension) : "?") << endl;
 
-    cout << "\tVertices: ";
+    *out << "\tVertices: ";
     for (vector<string>::const_iterator itStr(
              map_vertices_indexToLabel.begin());
          itStr != map_vertices_indexToLabel.end(); ++itStr)
-      cout << (itStr != map_vertices_indexToLabel.begin() ? ", " : "")
+      *out << (itStr != map_vertices_indexToLabel.begin() ? ", " : "")
            << *itStr;
-    cout << endl;
+    *out << endl;
   }
 
   // ---------------------------------------------------------------------------
   // Field generated by the entries of the Gram matrix
-  bool hasDottedLine = false;
-  for (const auto &order : orders) {
-    if (order == 1) { // dotted line
-      hasDottedLine = true;
-      break;
-    } else if (order == 4)
-      gramMatrixField += (gramMatrixField == "" ? "sqrt(2)" : ", sqrt(2)");
-    else if (order == 5)
-      gramMatrixField += (gramMatrixField == "" ? "sqrt(5)" : ", sqrt(5)");
-    else if (order == 6)
-      gramMatrixField += (gramMatrixField == "" ? "sqrt(3)" : ", sqrt(3)");
-    else if (order >= 7) // le static_cast est là pour VC++
-      gramMatrixField +=
-          (gramMatrixField == ""
-               ? "cos(pi/" + to_string(static_cast<long long>(order)) + ")"
-               : ", cos(pi/" + to_string(static_cast<long long>(order)) + ")");
-  }
-
-  if (!hasDottedLine) {
-    gramMatrixField =
-        gramMatrixField == "" ? "Q" : ("Q[" + gramMatrixField + "]");
-    isGramMatrixFieldKnown = true;
+  computeCyclicProducts();
 
-    if (bWriteInfo)
-      cout << "\tField generated by the entries of the Gram matrix: "
-           << gramMatrixField << endl;
-  } else {
-    if (bWriteInfo)
-      cout << "\tField generated by the entries of the Gram matrix: ?" << endl;
-  }
+  if (bWriteInfo)
+    *out << "\tField generated by the entries of the Gram matrix: "
+         << (isGramMatrixFieldKnown ? gramMatrixField : "?") << endl;
 
   if (bWriteInfo)
-    cout << "File read\n" << endl;
+    *out << "File read\n" << endl;
+}
 
-  return true;
+bool CoxIter::parseBinaryGraph(const char *data, const size_t &size) {
+  size_t recordSize;
+  return parseBinaryGraph(data, size, recordSize);
 }
 
-bool CoxIter::readGraphFromFile(const string &inputFilename) {
+bool CoxIter::parseBinaryGraph(const char *data, const size_t &size,
+                               size_t &recordSize) {
+  const unsigned char *bytes(reinterpret_cast<const unsigned char *>(data));
+  size_t position(0);
+
+  // Little-endian integer; false if the content is too short
+  auto readInteger = [&bytes, &size](size_t &offset, const unsigned int &width,
+                                     unsigned int &value) -> bool {
+    if (offset > size || size - offset < width)
+      return false;
+
+    value = 0;
+    for (unsigned int k(0); k < width; k++)
+      value |= static_cast<unsigned int>(bytes[offset + k]) << (8 * k);
+
+    offset += width;
+    return true;
+  };
+  auto align = [](size_t &offset) { offset += (4 - offset % 4) % 4; };
+
   // ---------------------------------------------------------------------------
-  // try to open the file
-  ifstream fileIn(inputFilename.c_str());
-  if (fileIn.fail()) {
-    error = "Cannot open file";
+  // header
+  unsigned int version, verticesFileCount, dimensionFile, orderWidth,
+      labelsSize, weightsCount;
+
+  if (size < 4 || string(data, 4) != "COXB") {
+    error = "Not a binary graph";
     return false;
   }
 
-  if (!parseGraph(fileIn))
+  position = 4;
+  if (!readInteger(position, 4, version) ||
+      !readInteger(position, 4, verticesFileCount) ||
+      !readInteger(position, 4, dimensionFile) ||
+      !readInteger(position, 4, orderWidth) ||
+      !readInteger(position, 4, labelsSize) ||
+      !readInteger(position, 4, weightsCount)) {
+    error = "Binary graph truncated";
     return false;
+  }
 
-  fileIn.close();
-
-  return true;
-}
-#endif
-
-void CoxIter::initializations() {
-  // ------------------------------------------------------
-  // de initializations
-  if (graphsList_spherical)
-    delete graphsList_spherical;
+  if (version != 1) {
+    error = "Unsupported version of the binary format: " + to_string(version);
+    return false;
+  }
 
-  if (graphsList_euclidean)
-    delete graphsList_euclidean;
+  if (orderWidth != 1 && orderWidth != 2 && orderWidth != 4) {
+    error = "Binary graph: invalid size of the orders";
+    return false;
+  }
 
-  graphsProductsCount_spherical.clear();
-  graphsProductsCount_euclidean.clear();
+  // Each vertex has a label (at least its '\0') and the dimension is at most
+  // the number of vertices: this bounds the allocations by the content size
+  if (verticesFileCount > size - position ||
+      dimensionFile > verticesFileCount) {
+    error = "Binary graph: invalid number of vertices or dimension";
+    return false;
+  }
 
-  factorials.clear();
-  powersOf2.clear();
+  // ---------------------------------------------------------------------------
+  // orders (read once the removed vertices are known)
+  const size_t ordersCount(verticesFileCount
+                               ? static_cast<size_t>(verticesFileCount) *
+                                     (verticesFileCount - 1) / 2
+                               : 0);
+  size_t ordersPosition(position);
+
+  if (ordersCount > (size - position) / orderWidth) {
+    error = "Binary graph truncated";
+    return false;
+  }
 
-  isGraphExplored = false;
-  isGraphsProductsComputed = false;
+  position += ordersCount * orderWidth;
+  align(position);
 
-  // ------------------------------------------------------
-  // initializations
-  coxeterMatrix = vector<vector<unsigned int>>(
-      verticesCount, vector<unsigned int>(verticesCount, 2));
-  visitedVertices = vector<bool>(verticesCount, false);
-  visitedEdges =
-      vector<vector<bool>>(verticesCount, vector<bool>(verticesCount, false));
+  // ---------------------------------------------------------------------------
+  // labels
+  if (position > size || labelsSize > size - position) {
+    error = "Binary graph truncated";
+    return false;
+  }
 
-  graphsList_spherical =
-      new GraphsList(verticesCount, &map_vertices_indexToLabel);
-  graphsList_euclidean =
-      new GraphsList(verticesCount, &map_vertices_indexToLabel);
+  resetGraph();
+  dimension = dimensionFile;
 
-  graphsProductsCount_euclidean =
-      vector<map<vector<vector<short unsigned int>>, unsigned int>>(
-          verticesCount + 1,
-          map<vector<vector<short unsigned int>>, unsigned int>());
-  graphsProductsCount_spherical =
-      vector<map<vector<vector<short unsigned int>>, unsigned int>>(
-          verticesCount + 1,
-          map<vector<vector<short unsigned int>>, unsigned int>());
+  const char *label(data + position), *labelsEnd(data + position + labelsSize);
+  while (label != labelsEnd) {
+    const char *labelEnd(find(label, labelsEnd, '\0'));
+    if (labelEnd == labelsEnd) {
+      error = "VERTICES_LABEL_COUNT";
+      return false;
+    }
 
-  // ------------------------------------------------------------
-  // sauvegarde de quelques calculs
-  factorials = vector<mpz_class>(verticesCount + 2, 1);
-  powersOf2 = vector<mpz_class>(verticesCount + 2, 1);
-  for (unsigned int i(1); i <= verticesCount + 1; i++) {
-    factorials[i] = factorials[i - 1] * (long int)i;
-    powersOf2[i] = mpz_class(2) * powersOf2[i - 1];
+    map_vertices_labelToIndex[string(label, labelEnd)] =
+        map_vertices_indexToLabel.size();
+    map_vertices_indexToLabel.push_back(string(label, labelEnd));
+    label = labelEnd + 1;
   }
-}
 
-bool CoxIter::writeGraph(const string &outFilenameBasis) {
-  if (outFilenameBasis == "") {
-    error = "No file specified for writing the graph";
+  if (map_vertices_indexToLabel.size() != verticesFileCount ||
+      map_vertices_labelToIndex.size() != verticesFileCount) {
+    error = "VERTICES_LABEL_COUNT";
     return false;
   }
 
-  map_vertices_labels_create();
+  position += labelsSize;
+  align(position);
 
-  string filename(outFilenameBasis + ".coxiter");
-  ofstream out(filename.c_str());
-  if (!out.is_open()) {
-    error = "Cannot open the file for writing the graph";
-    return false;
-  }
+  // ---------------------------------------------------------------------------
+  // removed vertices (same rules as parseGraph)
+  bool bRemoveDottedEdges(false);
+  vector<bool> isVertexRemoved(verticesFileCount, false);
 
-  out << verticesCount << (dimension ? " " + to_string(dimension) : "") << endl;
-  out << "vertices labels: ";
-  for (vector<string>::const_iterator it(map_vertices_indexToLabel.begin());
-       it != map_vertices_indexToLabel.end(); ++it)
-    out << (it == map_vertices_indexToLabel.begin() ? "" : " ") << *it;
-  out << endl;
+  // The member is kept as is, so that the next graph read is treated the same
+  vector<string> labelsToRemove(verticesToRemove);
+  if (vertices.size()) // If we want to specify a subset of the vertices
+  {
+    auto allVertices(map_vertices_indexToLabel);
+    sort(allVertices.begin(), allVertices.end());
 
-  for (unsigned int i(0); i < verticesCount; i++) {
-    for (unsigned int j(0); j < i; j++) {
-      if (coxeterMatrix[i][j] != 2)
-        out << map_vertices_indexToLabel[j] << " "
-            << map_vertices_indexToLabel[i] << " " << coxeterMatrix[i][j]
-            << endl;
-    }
+    set_difference(allVertices.begin(), allVertices.end(), vertices.begin(),
+                   vertices.end(), std::back_inserter(labelsToRemove));
+    sort(labelsToRemove.begin(), labelsToRemove.end());
+    labelsToRemove.erase(unique(labelsToRemove.begin(), labelsToRemove.end()),
+                         labelsToRemove.end());
   }
 
-  out.close();
+  for (const auto &vertexToRemove : labelsToRemove) {
+    auto it(map_vertices_labelToIndex.find(vertexToRemove));
 
-  return true;
-}
+    if (vertexToRemove == "dotted" &&
+        it == map_vertices_labelToIndex.end()) // remove dotted edges?
+    {
+      bRemoveDottedEdges = true;
+      continue;
+    }
 
-void CoxIter::map_vertices_labels_create() {
-  if (map_vertices_indexToLabel.size())
-    return; // nothing to do
+    if (it == map_vertices_labelToIndex.end()) {
+      error = "This vertex does not exist: " + vertexToRemove;
+      return false;
+    }
 
-  for (unsigned int i(0); i < verticesCount; i++) {
-    map_vertices_labelToIndex[to_string(i + 1)] = i;
-    map_vertices_indexToLabel.push_back(to_string(i + 1));
+    isVertexRemoved[it->second] = true;
   }
-}
 
-void CoxIter::map_vertices_labels_reinitialize() {
-  map_vertices_labelToIndex.clear();
-  map_vertices_indexToLabel.clear();
+  vector<unsigned int> newIndices(verticesFileCount, 0);
+  verticesCount = 0;
+  for (unsigned int i(0); i < verticesFileCount; i++) {
+    if (!isVertexRemoved[i])
+      newIndices[i] = verticesCount++;
+  }
 
-  for (unsigned int i(0); i < verticesCount; i++) {
-    map_vertices_labelToIndex[to_string(i + 1)] = i;
-    map_vertices_indexToLabel.push_back(to_string(i + 1));
+  // ---------------------------------------------------------------------------
+  // initializations
+  initializations(); // now that we know the real number of vertices
+
+  // ---------------------------------------------------------------------------
+  // Coxeter matrix
+  unsigned int order;
+  for (unsigned int i(0); i < verticesFileCount; i++) {
+    for (unsigned int j(i + 1); j < verticesFileCount; j++) {
+      readInteger(ordersPosition, orderWidth, order);
+
+      if (order == 1 && bRemoveDottedEdges)
+        order = 2;
+
+      if (isVertexRemoved[i] || isVertexRemoved[j])
+        continue;
+
+      coxeterMatrix[newIndices[i]][newIndices[j]] = order;
+      coxeterMatrix[newIndices[j]][newIndices[i]] = order;
+
+      if (order == 1) // dotted
+        hasDottedLine = true;
+      else if (order == 0)
+        hasBoldLine = true;
+    }
   }
-}
 
-bool CoxIter::writeGraphToDraw(const string &outFilenameBasis) {
-  unsigned int i, j;
+  // ---------------------------------------------------------------------------
+  // weights of the dotted edges
+  unsigned int row, col, length;
+  for (unsigned int i(0); i < weightsCount; i++) {
+    if (!readInteger(position, 4, row) || !readInteger(position, 4, col) ||
+        !readInteger(position, 4, length) || length > size - position) {
+      error = "Binary graph truncated";
+      return false;
+    }
 
-  map_vertices_labels_create();
+    if (row >= col || col >= verticesFileCount) {
+      error = "Binary graph: invalid dotted edge";
+      return false;
+    }
 
-  // ----------------------------------------------------------------------
-  // ouverture du fichier
-  if (outFilenameBasis == "") {
-    error = "No file specified for writing the graph";
-    return false;
+    if (!isVertexRemoved[row] && !isVertexRemoved[col] &&
+        coxeterMatrix[newIndices[row]][newIndices[col]] == 1)
+      weightsDotted[linearizationMatrix_index(newIndices[row], newIndices[col],
+                                              verticesCount)] =
+          string(data + position, length);
+
+    position += length;
+    align(position);
   }
 
-  string filename(outFilenameBasis + ".graphviz");
-  ofstream out(filename.c_str());
-  if (!out.is_open()) {
-    error = "Cannot open the file for writing the graph";
-    return false;
+  recordSize = position;
+
+  for (unsigned int i(0); i < verticesCount; i++) {
+    for (unsigned int j(i + 1); j < verticesCount; j++) {
+      if (coxeterMatrix[i][j] == 1 &&
+          weightsDotted.find(linearizationMatrix_index(
+              i, j, verticesCount)) == weightsDotted.end())
+        hasDottedLineWithoutWeight = 1;
+    }
   }
 
-  // ----------------------------------------------------------------------
-  // écriture à proprement parler
-  out << "graph G { " << endl;
-  for (i = 0; i < verticesCount; i++)
-    out << "\t\"" << map_vertices_indexToLabel[i] << "\";" << endl;
+  // ---------------------------------------------------------------------------
+  // Labels of the remaining vertices
+  auto v_ItL(map_vertices_indexToLabel);
+  map_vertices_indexToLabel.clear();
+  map_vertices_labelToIndex.clear();
 
-  for (i = 0; i < verticesCount; i++) {
-    for (j = i + 1; j < verticesCount; j++) {
-      if (coxeterMatrix[i][j] > 3)
-        out << "\t\"" << map_vertices_indexToLabel[i] << "\" -- \""
-            << map_vertices_indexToLabel[j] << "\" [label=\""
-            << coxeterMatrix[i][j] << "\"];" << endl;
-      else if (coxeterMatrix[i][j] > 2)
-        out << "\t\"" << map_vertices_indexToLabel[i] << "\" -- \""
-            << map_vertices_indexToLabel[j] << "\";" << endl;
-      else if (coxeterMatrix[i][j] == 1)
-        out << "\t\"" << map_vertices_indexToLabel[i] << "\" -- \""
-            << map_vertices_indexToLabel[j] << "\" [style=dotted];" << endl;
-      else if (coxeterMatrix[i][j] == 0)
-        out << "\t\"" << map_vertices_indexToLabel[i] << "\" -- \""
-            << map_vertices_indexToLabel[j] << "\" [label=\"inf\"];" << endl;
+  for (unsigned int i(0); i < verticesFileCount; i++) {
+    if (!isVertexRemoved[i]) {
+      map_vertices_labelToIndex[v_ItL[i]] = map_vertices_indexToLabel.size();
+      map_vertices_indexToLabel.push_back(v_ItL[i]);
     }
   }
 
-  out << "}";
-  out.close();
+  finalizeGraphReading();
 
   return true;
 }
 
-void CoxIter::exploreGraph() {
-  vector<short unsigned int> vertices;
-  short unsigned int i, j, k, l;
+bool CoxIter::parseBinaryGraph(istream &streamIn) {
+  const string content((istreambuf_iterator<char>(streamIn)),
+                       istreambuf_iterator<char>());
 
-  if (!verticesCount)
-    throw(string("CoxIter::exploreGraph: No graph given"));
+  return parseBinaryGraph(content.data(), content.size());
+}
 
-  if (isGraphExplored)
-    return;
+size_t CoxIter::binaryGraphSize(const char *data, const size_t &size) {
+  const unsigned char *bytes(reinterpret_cast<const unsigned char *>(data));
 
-  // -------------------------------------------------------------------
-  // pour chaque sommet, on cherche toutes les chaînes qui partent, ce qui donne
-  // les An, Bn, Dn, En, Hn
-  path.clear();
+  auto readInteger = [&bytes, &size](size_t &offset,
+                                     unsigned int &value) -> bool {
+    if (offset > size || size - offset < 4)
+      return false;
 
-  for (i = 0; i < verticesCount; i++) {
-    path.clear();
-    visitedVertices = vector<bool>(verticesCount, false);
-    visitedEdges =
-        vector<vector<bool>>(verticesCount, vector<bool>(verticesCount, false));
+    value = bytes[offset] | (bytes[offset + 1] << 8) |
+            (bytes[offset + 2] << 16) |
+            (static_cast<unsigned int>(bytes[offset + 3]) << 24);
+    offset += 4;
+    return true;
+  };
+  auto align = [](size_t &offset) { offset += (4 - offset % 4) % 4; };
+
+  unsigned int version, verticesFileCount, dimension, orderWidth, labelsSize,
+      weightsCount, row, col, length;
+  size_t position(4);
+
+  if (size < 4 || string(data, 4) != "COXB" ||
+      !readInteger(position, version) ||
+      !readInteger(position, verticesFileCount) ||
+      !readInteger(position, dimension) ||
+      !readInteger(position, orderWidth) ||
+      !readInteger(position, labelsSize) ||
+      !readInteger(position, weightsCount))
+    return 0;
 
-    DFS(i, i);
+  position += static_cast<size_t>(verticesFileCount) *
+              (verticesFileCount ? verticesFileCount - 1 : 0) / 2 * orderWidth;
+  align(position);
+  position += labelsSize;
+  align(position);
+
+  for (unsigned int i(0); i < weightsCount; i++) {
+    if (!readInteger(position, row) || !readInteger(position, col) ||
+        !readInteger(position, length))
+      return 0;
+
+    position += length;
+    align(position);
   }
 
-  // -------------------------------------------------------------------
-  // recherche des A_1, G_2^k avec k >= 4, F_4
-  vector<bool> linkableVertices, linkableVerticesTemp;
-  for (i = 0; i < verticesCount; i++) {
-    linkableVertices = vector<bool>(verticesCount, true);
-    for (j = 0; j < verticesCount; j++) {
-      if (coxeterMatrix[i][j] != 2)
-        linkableVertices[j] = false;
-    }
+  return position <= size ? position : 0;
+}
 
-    // ajout du sommet (A_1)
-    linkableVertices[i] = false;
-    graphsList_spherical->addGraph(vector<short unsigned int>(1, i),
-                                   linkableVertices, 0, true);
+bool CoxIter::readGraphFromFile(const string &inputFilename) {
+  // ---------------------------------------------------------------------------
+  // try to open the file
+  ifstream fileIn(inputFilename.c_str());
+  if (fileIn.fail()) {
+    error = "Cannot open file";
+    return false;
+  }
 
-    // on regarde si on trouve avec ce sommet: Gn, TA1 ,TC2
-    for (j = 0; j < verticesCount; j++) {
-      if (coxeterMatrix[i][j] >= 4 || !coxeterMatrix[i][j]) {
-        // ------------------------------------------------------------------
-        // G2 et TA1
-        if (i < j) {
-          vertices.clear();
-          vertices.push_back(i);
-          vertices.push_back(j);
+  if (!parseGraph(fileIn))
+    return false;
 
-          linkableVerticesTemp = linkableVertices;
-          for (k = 0; k < verticesCount; k++) {
-            if (coxeterMatrix[j][k] != 2)
-              linkableVerticesTemp[k] = false;
-          }
+  fileIn.close();
 
-          if (coxeterMatrix[i][j]) // ici, c'est un graphe sphérique
-            graphsList_spherical->addGraph(vertices, linkableVerticesTemp, 6,
-                                           true, 0, 0, coxeterMatrix[i][j]);
-          else // ici, graphe euclidien (TA1)
-            graphsList_euclidean->addGraph(vertices, linkableVerticesTemp, 0,
-                                           false, 0, 0, 0);
-        }
+  return true;
+}
 
-        // ------------------------------------------------------------------
-        // TC2 = [ 4, 4 ]
-        if (coxeterMatrix[i][j] == 4) {
-          for (k = 0; k < verticesCount; k++) {
-            if (coxeterMatrix[k][j] == 4 && i != k &&
-                coxeterMatrix[i][k] == 2) {
-              linkableVerticesTemp = linkableVertices;
-              for (l = 0; l < verticesCount; l++) {
-                if (coxeterMatrix[k][l] != 2)
-                  linkableVerticesTemp[l] = false;
-                if (coxeterMatrix[j][l] != 2)
-                  linkableVerticesTemp[l] = false;
-              }
+void CoxIter::initializations() {
+  // ------------------------------------------------------
+  // de initializations
+  if (graphsList_spherical)
+    delete graphsList_spherical;
 
-              graphsList_euclidean->addGraph(vector<short unsigned int>(1, j),
-                                             linkableVerticesTemp, 2, false, i,
-                                             k);
-            }
-          }
-        }
-      }
-    }
-  }
+  if (graphsList_euclidean)
+    delete graphsList_euclidean;
 
-  isGraphExplored = true;
-}
+  graphsProductsCount_spherical.clear();
+  graphsProductsCount_euclidean.clear();
 
-void CoxIter::DFS(unsigned int root, unsigned int from) {
-  // -------------------------------------------------------------------
-  // initializations
-  bool subcall(false); // to know if we call DFS
+  factorials.clear();
+  powersOf2.clear();
 
-  unsigned int i;
+  isGraphExplored = false;
+  isGraphsProductsComputed = false;
 
-  /*
-   * 	We don't want cycles
-   * 		We mark neighbours of from as visited (to avoir cycles)
-   * 		We stock this in verticesVisited to restore it at the end
-   */
-  vector<unsigned int> visitedVerticesIdx;
+  isCyclicProductsComputed = false;
+  cyclicProducts.clear();
 
-  if (root != from) {
-    for (i = 0; i < verticesCount; i++) {
-      if (coxeterMatrix[from][i] != 2) {
-        if (!visitedVertices[i])
-          visitedVerticesIdx.push_back(i);
+  // ------------------------------------------------------
+  // initializations
+  coxeterMatrix = vector<vector<unsigned int>>(
+      verticesCount, vector<unsigned int>(verticesCount, 2));
+  visitedVertices = vector<bool>(verticesCount, false);
+  visitedEdges =
+      vector<vector<bool>>(verticesCount, vector<bool>(verticesCount, false));
 
-        visitedVertices[i] = true;
-      }
-    }
-  } else
-    visitedVertices[root] = true; // obviously...
+  graphsList_spherical =
+      new GraphsList(verticesCount, &map_vertices_indexToLabel);
+  graphsList_euclidean =
+      new GraphsList(verticesCount, &map_vertices_indexToLabel);
 
-  // -------------------------------------------------------------------
-  // DFS
-  path.push_back(root); // we add root to the path
+  graphsProductsCount_euclidean =
+      vector<map<vector<vector<short unsigned int>>, unsigned int>>(
+          verticesCount + 1,
+          map<vector<vector<short unsigned int>>, unsigned int>());
+  graphsProductsCount_spherical =
+      vector<map<vector<vector<short unsigned int>>, unsigned int>>(
+          verticesCount + 1,
+          map<vector<vector<short unsigned int>>, unsigned int>());
 
-  for (i = 0; i < verticesCount; i++) {
-    // if we have an edge AND if i was not traversed AND if the edge (root,i)
-    // was not traversed
-    if (coxeterMatrix[root][i] == 3 && !visitedVertices[i] &&
-        !visitedEdges[root][i]) {
-      visitedEdges[root][i] = visitedEdges[i][root] = true;
-      subcall = true;
-      DFS(i, root);
-    }
+  // ------------------------------------------------------------
+  // sauvegarde de quelques calculs
+  factorials = vector<mpz_class>(verticesCount + 2, 1);
+  powersOf2 = vector<mpz_class>(verticesCount + 2, 1);
+  for (unsigned int i(1); i <= verticesCount + 1; i++) {
+    factorials[i] = factorials[i - 1] * (long int)i;
+    powersOf2[i] = mpz_class(2) * powersOf2[i - 1];
   }
+}
 
-  // -------------------------------------------------------------------
-  // un-initializations
-  for (const auto &visitedVertex : visitedVerticesIdx)
-    visitedVertices[visitedVertex] = false;
-
-  visitedVertices[root] = false;
+void CoxIter::resetGraph() {
+  error = "";
 
-  if (from != root) // If it is a recursive call
-    visitedEdges[root][from] = visitedEdges[from][root] = false;
+  // ---------------------------------------------------------------------------
+  // graph
+  verticesCount = 0;
+  maximalSubgraphRank = 0;
 
-  // If DFS was not called, then the path is maximal
-  if (!subcall)
-    addGraphsFromPath();
+  map_vertices_labelToIndex.clear();
+  map_vertices_indexToLabel.clear();
+  coxeterMatrix.clear();
+  weightsDotted.clear();
+  visitedEdges.clear();
+  visitedVertices.clear();
+  path.clear();
 
-  path.pop_back();
-}
+  hasBoldLine = false;
+  hasDottedLine = false;
+  hasDottedLineWithoutWeight = 0;
+
+  isDimensionGuessed = false;
+  euclideanMaxRankFound = 0;
+  sphericalMaxRankFound = 0;
+
+  isGramMatrixFieldKnown = false;
+  gramMatrixField = "";
+
+  isCyclicProductsComputed = false;
+  cyclicProducts.clear();
+  cyclicProductsField = "";
+
+  // ---------------------------------------------------------------------------
+  // connected subgraphs and graphs products (graphsById points to the lists)
+  if (graphsList_spherical)
+    delete graphsList_spherical;
+
+  if (graphsList_euclidean)
+    delete graphsList_euclidean;
+
+  graphsList_spherical = nullptr;
+  graphsList_euclidean = nullptr;
+  graphsById.clear();
+
+  isGraphExplored = false;
+  isGraphsProductsComputed = false;
+
+  graphsProducts.clear();
+  isGraphsProductsIds = false;
+  isCheckStreamed = false;
+  graphsProductsIds.clear();
+  graphsProductsExtensions.clear();
+  graphsProductsStreamedCount.fill(0);
+  graphsProducts_canBeFiniteCovolume.clear();
+  graphsProductsCount_spherical.clear();
+  graphsProductsCount_euclidean.clear();
+
+  factorials.clear();
+  powersOf2.clear();
+
+  infSeq_t0 = 0;
+  infSeq_s0 = 0;
+  infSeqFVectorsUnits.clear();
+  infSeqFVectorsPowers.clear();
+  isInfSeqInGraphsProducts = false;
+
+  // ---------------------------------------------------------------------------
+  // results
+  brEulerCaracteristic = 0;
+  eulerCharacteristic_computations = "";
+  fVectorAlternateSum = 0;
+  fVector.clear();
+  verticesAtInfinityCount = 0;
+
+  isGrowthSeriesComputed = false;
+  growthSeries_polynomialDenominator.clear();
+  growthSeries_cyclotomicNumerator.clear();
+  growthSeries_isFractionReduced = false;
+  growthSeries_raw = "";
+
+  isArithmetic = -1;
+  isCocompact = -2;
+  isFiniteCovolume = -2;
+
+  stats = CoxIter_Stats();
+}
+
+bool CoxIter::writeGraph(const string &outFilenameBasis) {
+  if (outFilenameBasis == "") {
+    error = "No file specified for writing the graph";
+    return false;
+  }
+
+  map_vertices_labels_create();
+
+  string filename(outFilenameBasis + ".coxiter");
+  ofstream out(filename.c_str());
+  if (!out.is_open()) {
+    error = "Cannot open the file for writing the graph";
+    return false;
+  }
+
+  out << verticesCount << (dimension ? " " + to_string(dimension) : "") << endl;
+  out << "vertices labels: ";
+  for (vector<string>::const_iterator it(map_vertices_indexToLabel.begin());
+       it != map_vertices_indexToLabel.end(); ++it)
+    out << (it == map_vertices_indexToLabel.begin() ? "" : " ") << *it;
+  out << endl;
+
+  for (unsigned int i(0); i < verticesCount; i++) {
+    for (unsigned int j(0); j < i; j++) {
+      if (coxeterMatrix[i][j] != 2)
+        out << map_vertices_indexToLabel[j] << " "
+            << map_vertices_indexToLabel[i] << " " << coxeterMatrix[i][j]
+            << endl;
+    }
+  }
+
+  out.close();
+
+  return true;
+}
+
+
+bool CoxIter::readGraphFromBinaryFile(const string &inputFilename) {
+  ifstream fileIn(inputFilename.c_str(), ios::binary);
+  if (fileIn.fail()) {
+    error = "Cannot open file";
+    return false;
+  }
+
+  return parseBinaryGraph(fileIn);
+}
+
+bool CoxIter::writeBinaryGraph(ostream &streamOut) {
+  map_vertices_labels_create();
+
+  string content("COXB");
+
+  // Little-endian integer
+  auto writeInteger = [&content](const unsigned int &value,
+                                 const unsigned int &width) {
+    for (unsigned int k(0); k < width; k++)
+      content.push_back(static_cast<char>((value >> (8 * k)) & 0xFF));
+  };
+  auto align = [&content]() {
+    content.append((4 - content.size() % 4) % 4, '\0');
+  };
+
+  unsigned int maxOrder(0);
+  for (unsigned int i(0); i < verticesCount; i++) {
+    for (unsigned int j(i + 1); j < verticesCount; j++)
+      maxOrder = max(maxOrder, coxeterMatrix[i][j]);
+  }
+
+  unsigned int orderWidth(maxOrder < 256 ? 1 : (maxOrder < 65536 ? 2 : 4));
+
+  string labels;
+  for (const auto &label : map_vertices_indexToLabel) {
+    labels += label;
+    labels.push_back('\0');
+  }
+
+  // ---------------------------------------------------------------------------
+  // header
+  writeInteger(1, 4); // version
+  writeInteger(verticesCount, 4);
+  writeInteger(dimension, 4);
+  writeInteger(orderWidth, 4);
+  writeInteger(labels.size(), 4);
+  writeInteger(weightsDotted.size(), 4);
+
+  // ---------------------------------------------------------------------------
+  // orders, labels and weights
+  for (unsigned int i(0); i < verticesCount; i++) {
+    for (unsigned int j(i + 1); j < verticesCount; j++)
+      writeInteger(coxeterMatrix[i][j], orderWidth);
+  }
+  align();
+
+  content += labels;
+  align();
+
+  for (const auto &weight : weightsDotted) {
+    writeInteger(linearizationMatrix_row(weight.first, verticesCount), 4);
+    writeInteger(linearizationMatrix_col(weight.first, verticesCount), 4);
+    writeInteger(weight.second.size(), 4);
+    content += weight.second;
+    align();
+  }
+
+  streamOut.write(content.data(), content.size());
+
+  if (!streamOut) {
+    error = "Cannot write the graph";
+    return false;
+  }
+
+  return true;
+}
+
+bool CoxIter::writeBinaryGraph(const string &outFilenameBasis) {
+  if (outFilenameBasis == "") {
+    error = "No file specified for writing the graph";
+    return false;
+  }
+
+  string filename(outFilenameBasis + ".coxiterb");
+  ofstream out(filename.c_str(), ios::binary);
+  if (!out.is_open()) {
+    error = "Cannot open the file for writing the graph";
+    return false;
+  }
+
+  if (!writeBinaryGraph(out))
+    return false;
+
+  out.close();
+
+  return true;
+}
+
+void CoxIter::map_vertices_labels_create() {
+  if (map_vertices_indexToLabel.size())
+    return; // nothing to do
+
+  for (unsigned int i(0); i < verticesCount; i++) {
+    map_vertices_labelToIndex[to_string(i + 1)] = i;
+    map_vertices_indexToLabel.push_back(to_string(i + 1));
+  }
+}
+
+void CoxIter::map_vertices_labels_reinitialize() {
+  map_vertices_labelToIndex.clear();
+  map_vertices_indexToLabel.clear();
+
+  for (unsigned int i(0); i < verticesCount; i++) {
+    map_vertices_labelToIndex[to_string(i + 1)] = i;
+    map_vertices_indexToLabel.push_back(to_string(i + 1));
+  }
+}
+
+bool CoxIter::writeGraphToDraw(const string &outFilenameBasis) {
+  unsigned int i, j;
+
+  map_vertices_labels_create();
+
+  // ----------------------------------------------------------------------
+  // ouverture du fichier
+  if (outFilenameBasis == "") {
+    error = "No file specified for writing the graph";
+    return false;
+  }
+
+  string filename(outFilenameBasis + ".graphviz");
+  ofstream out(filename.c_str());
+  if (!out.is_open()) {
+    error = "Cannot open the file for writing the graph";
+    return false;
+  }
+
+  // ----------------------------------------------------------------------
+  // écriture à proprement parler
+  out << "graph G { " << endl;
+  for (i = 0; i < verticesCount; i++)
+    out << "\t\"" << map_vertices_indexToLabel[i] << "\";" << endl;
+
+  for (i = 0; i < verticesCount; i++) {
+    for (j = i + 1; j < verticesCount; j++) {
+      if (coxeterMatrix[i][j] > 3)
+        out << "\t\"" << map_vertices_indexToLabel[i] << "\" -- \""
+            << map_vertices_indexToLabel[j] << "\" [label=\""
+            << coxeterMatrix[i][j] << "\"];" << endl;
+      else if (coxeterMatrix[i][j] > 2)
+        out << "\t\"" << map_vertices_indexToLabel[i] << "\" -- \""
+            << map_vertices_indexToLabel[j] << "\";" << endl;
+      else if (coxeterMatrix[i][j] == 1)
+        out << "\t\"" << map_vertices_indexToLabel[i] << "\" -- \""
+            << map_vertices_indexToLabel[j] << "\" [style=dotted];" << endl;
+      else if (coxeterMatrix[i][j] == 0)
+        out << "\t\"" << map_vertices_indexToLabel[i] << "\" -- \""
+            << map_vertices_indexToLabel[j] << "\" [label=\"inf\"];" << endl;
+    }
+  }
+
+  out << "}";
+  out.close();
+
+  return true;
+}
+
+void CoxIter::exploreGraph() {
+  vector<short unsigned int> vertices;
+  short unsigned int i, j, k, l;
+
+  if (!verticesCount)
+    throw(string("CoxIter::exploreGraph: No graph given"));
+
+  if (isGraphExplored)
+    return;
+
+  StageTimer timer(stats.exploreGraphTime);
+
+  // -------------------------------------------------------------------
+  // pour chaque sommet, on cherche toutes les chaînes qui partent, ce qui donne
+  // les An, Bn, Dn, En, Hn
+  path.clear();
+
+  for (i = 0; i < verticesCount; i++) {
+    path.clear();
+    visitedVertices = vector<bool>(verticesCount, false);
+    visitedEdges =
+        vector<vector<bool>>(verticesCount, vector<bool>(verticesCount, false));
+
+    DFS(i, i);
+  }
+
+  // -------------------------------------------------------------------
+  // recherche des A_1, G_2^k avec k >= 4, F_4
+  vector<bool> linkableVertices, linkableVerticesTemp;
+  for (i = 0; i < verticesCount; i++) {
+    linkableVertices = vector<bool>(verticesCount, true);
+    for (j = 0; j < verticesCount; j++) {
+      if (coxeterMatrix[i][j] != 2)
+        linkableVertices[j] = false;
+    }
+
+    // ajout du sommet (A_1)
+    linkableVertices[i] = false;
+    graphsList_spherical->addGraph(vector<short unsigned int>(1, i),
+                                   linkableVertices, 0, true);
+
+    // on regarde si on trouve avec ce sommet: Gn, TA1 ,TC2
+    for (j = 0; j < verticesCount; j++) {
+      if (coxeterMatrix[i][j] >= 4 || !coxeterMatrix[i][j]) {
+        // ------------------------------------------------------------------
+        // G2 et TA1
+        if (i < j) {
+          vertices.clear();
+          vertices.push_back(i);
+          vertices.push_back(j);
+
+          linkableVerticesTemp = linkableVertices;
+          for (k = 0; k < verticesCount; k++) {
+            if (coxeterMatrix[j][k] != 2)
+              linkableVerticesTemp[k] = false;
+          }
+
+          if (coxeterMatrix[i][j]) // ici, c'est un graphe sphérique
+            graphsList_spherical->addGraph(vertices, linkableVerticesTemp, 6,
+                                           true, 0, 0, coxeterMatrix[i][j]);
+          else // ici, graphe euclidien (TA1)
+            graphsList_euclidean->addGraph(vertices, linkableVerticesTemp, 0,
+                                           false, 0, 0, 0);
+        }
+
+        // ------------------------------------------------------------------
+        // TC2 = [ 4, 4 ]
+        if (coxeterMatrix[i][j] == 4) {
+          for (k = 0; k < verticesCount; k++) {
+            if (coxeterMatrix[k][j] == 4 && i != k &&
+                coxeterMatrix[i][k] == 2) {
+              linkableVerticesTemp = linkableVertices;
+              for (l = 0; l < verticesCount; l++) {
+                if (coxeterMatrix[k][l] != 2)
+                  linkableVerticesTemp[l] = false;
+                if (coxeterMatrix[j][l] != 2)
+                  linkableVerticesTemp[l] = false;
+              }
+
+              graphsList_euclidean->addGraph(vector<short unsigned int>(1, j),
+                                             linkableVerticesTemp, 2, false, i,
+                                             k);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  stats.sphericalGraphsCount = graphsList_spherical->totalGraphsCount;
+  stats.euclideanGraphsCount = graphsList_euclidean->totalGraphsCount;
+
+  computeGraphsIds();
+  isGraphExplored = true;
+}
+
+void CoxIter::DFS(unsigned int root, unsigned int from) {
+  // -------------------------------------------------------------------
+  // initializations
+  bool subcall(false); // to know if we call DFS
+
+  unsigned int i;
+
+  /*
+   * 	We don't want cycles
+   * 		We mark neighbours of from as visited (to avoir cycles)
+   * 		We stock this in verticesVisited to restore it at the end
+   */
+  vector<unsigned int> visitedVerticesIdx;
+
+  if (root != from) {
+    for (i = 0; i < verticesCount; i++) {
+      if (coxeterMatrix[from][i] != 2) {
+        if (!visitedVertices[i])
+          visitedVerticesIdx.push_back(i);
+
+        visitedVertices[i] = true;
+      }
+    }
+  } else
+    visitedVertices[root] = true; // obviously...
+
+  // -------------------------------------------------------------------
+  // DFS
+  path.push_back(root); // we add root to the path
+
+  for (i = 0; i < verticesCount; i++) {
+    // if we have an edge AND if i was not traversed AND if the edge (root,i)
+    // was not traversed
+    if (coxeterMatrix[root][i] == 3 && !visitedVertices[i] &&
+        !visitedEdges[root][i]) {
+      visitedEdges[root][i] = visitedEdges[i][root] = true;
+      subcall = true;
+      DFS(i, root);
+    }
+  }
+
+  // -------------------------------------------------------------------
+  // un-initializations
+  for (const auto &visitedVertex : visitedVerticesIdx)
+    visitedVertices[visitedVertex] = false;
+
+  visitedVertices[root] = false;
+
+  if (from != root) // If it is a recursive call
+    visitedEdges[root][from] = visitedEdges[from][root] = false;
+
+  // If DFS was not called, then the path is maximal
+  if (!subcall)
+    addGraphsFromPath();
+
+  path.pop_back();
+}
 
 void CoxIter::addGraphsFromPath() {
   // sommets que l'on ne peut pas lier au graphe (n sommets);
   vector<bool> linkableVertices(verticesCount, true);
 
-  // sommets que l'on ne peut pas lier au graphe (n-1 sommets), sommets que l'on
-  // ne peut pas lier au graphe (n-2 sommets)
-  vector<bool> linkableVertices_0_nMin1(verticesCount, true),
-      linkableVertices_0_nMin2(verticesCount, true);
+  // sommets que l'on ne peut pas lier au graphe (n-1 sommets), sommets que l'on
+  // ne peut pas lier au graphe (n-2 sommets)
+  vector<bool> linkableVertices_0_nMin1(verticesCount, true),
+      linkableVertices_0_nMin2(verticesCount, true);
+
+  // sommets que l'on ne peut pas lier au graphe (1 --> n), sommets que l'on ne
+  // peut pas lier au graphe (1 --> n-1), , sommets que l'on ne peut pas lier au
+  // graphe (2 --> n)
+  vector<bool> linkableVertices_1_n(verticesCount, true),
+      linkableVertices_1_nMin1(verticesCount, true),
+      linkableVertices_2_n(verticesCount, true);
+
+  // vecteur temporaire
+  vector<bool> linkableVerticesTemp, linkableVerticesTempTemp;
+
+  // chemin en cours de construction
+  vector<short unsigned int> pathTemp;
+
+  // i, j, k, l: variables de boucles
+  short unsigned int i, j, k, l, max(path.size()), iOrder;
+
+  for (i = 0; i < max; i++) {
+    pathTemp.push_back(path[i]);
+
+    // --------------------------------------------------------------------
+    // mise à jour des voisinages occupés
+    for (j = 0; j < verticesCount; j++) {
+      if (coxeterMatrix[path[i]][j] != 2)
+        linkableVertices[j] = false;
+
+      if (i >= 1 && coxeterMatrix[path[i]][j] != 2)
+        linkableVertices_1_n[j] = false;
+
+      if (i >= 2 && coxeterMatrix[path[i]][j] != 2)
+        linkableVertices_2_n[j] = false;
+
+      if (i >= 1 && coxeterMatrix[path[i - 1]][j] != 2)
+        linkableVertices_0_nMin1[j] = false;
+
+      if (i >= 2 && coxeterMatrix[path[i - 1]][j] != 2)
+        linkableVertices_1_nMin1[j] = false;
+
+      if (i >= 2 && coxeterMatrix[path[i - 2]][j] != 2)
+        linkableVertices_0_nMin2[j] = false;
+    }
+
+    // --------------------------------------------------------------------
+    // An
+    if (i != 0) // on ajoute pas les sommets
+      graphsList_spherical->addGraph(pathTemp, linkableVertices, 0, true);
+
+    // --------------------------------------------------------------------
+    // TAn, n >= 2
+    if (i >= 1) {
+      linkableVertices_1_nMin1[pathTemp[i - 1]] = false;
+
+      for (j = 0; j < verticesCount; j++) {
+        // si la partie centrale ne pose pas de problème ET qu'on est lié à
+        // chaque extrémité
+        if (linkableVertices_1_nMin1[j] && !linkableVertices[j] &&
+            coxeterMatrix[j][pathTemp[0]] == 3 &&
+            coxeterMatrix[j][pathTemp[i]] == 3) {
+          // mise à jour des linkables avec le somme trouvé
+          linkableVerticesTemp = linkableVertices;
+          for (k = 0; k < verticesCount; k++) {
+            if (coxeterMatrix[k][j] != 2)
+              linkableVerticesTemp[k] = false;
+          }
+
+          graphsList_euclidean->addGraph(
+              pathTemp, linkableVerticesTemp, 0, false, j, 0,
+              1); // TODO OPTIMIZATION modifier ce 1 (relatif à une meilleure
+                  // valeur que "0" par défaut pour les dernières variables)
+        }
+      }
+    }
+
+    // --------------------------------------------------------------------
+    // Dn, TBn, TDn
+    if (i >= 2) {
+      linkableVertices_0_nMin2[pathTemp[i - 2]] = false;
+
+      // --------------------------------------------------------------------
+      // Dn, TBn (n >= 4), TDn (n >= 4)
+      // on regarde les voisins de l'avant dernier sommet
+      for (j = 0; j < verticesCount; j++) {
+        // si y'a une arête ET si on est pas déjà dans le chemin ET si pas
+        // interdit ET pas lien entre deux extrémités
+        if (coxeterMatrix[j][pathTemp[i - 1]] == 3 &&
+            (pathTemp[i - 1] != j && pathTemp[i] != j) &&
+            linkableVertices_0_nMin2[j] && coxeterMatrix[j][pathTemp[i]] == 2) {
+          linkableVerticesTemp = linkableVertices;
+          for (k = 0; k < verticesCount; k++) {
+            if (coxeterMatrix[k][j] != 2)
+              linkableVerticesTemp[k] = false;
+          }
+
+          graphsList_spherical->addGraph(pathTemp, linkableVerticesTemp, 3,
+                                         true, j); // Dn
+
+          // --------------------------------------------------------------------
+          // ici, on va tenter de trouver un TD_n (n >= 4) (i.e. prolonger par
+          // une arrête au 2ème sommet)
+          for (k = 0; k < verticesCount; k++) {
+            if (k != pathTemp[0] && k != j && k != pathTemp[i] &&
+                coxeterMatrix[pathTemp[1]][k] == 3 && linkableVertices_2_n[k] &&
+                coxeterMatrix[pathTemp[0]][k] == 2 &&
+                coxeterMatrix[k][j] == 2) {
+              linkableVerticesTempTemp = linkableVerticesTemp;
+              for (l = 0; l < verticesCount; l++) {
+                if (coxeterMatrix[k][l] != 2)
+                  linkableVerticesTempTemp[l] = false;
+              }
+
+              graphsList_euclidean->addGraph(pathTemp, linkableVerticesTempTemp,
+                                             3, false, k, j); // TDn
+            }
+          }
+
+          // --------------------------------------------------------------------
+          // ici, on va tenter de trouver un TB_n (n >= 4) (i.e. prolonger par
+          // une arête de poids 4 à gauche)
+          for (k = 0; k < verticesCount; k++) {
+            if (coxeterMatrix[pathTemp[0]][k] == 4 && linkableVertices_1_n[k] &&
+                coxeterMatrix[j][k] == 2) {
+              linkableVerticesTempTemp = linkableVerticesTemp;
+              for (l = 0; l < verticesCount; l++) {
+                if (coxeterMatrix[k][l] != 2)
+                  linkableVerticesTempTemp[l] = false;
+              }
+
+              graphsList_euclidean->addGraph(pathTemp, linkableVerticesTempTemp,
+                                             1, false, j, k, 1); // TBn
+            }
+          }
+        }
+
+        // --------------------------------------------------------------------
+        // TB3
+        if (i == 2) {
+          if (coxeterMatrix[pathTemp[1]][j] == 4 &&
+              coxeterMatrix[pathTemp[0]][j] == 2 &&
+              coxeterMatrix[pathTemp[2]][j] == 2) {
+            linkableVerticesTemp = linkableVertices;
+            for (k = 0; k < verticesCount; k++) {
+              if (coxeterMatrix[k][j] != 2)
+                linkableVerticesTemp[k] = false;
+            }
+
+            graphsList_euclidean->addGraph(pathTemp, linkableVerticesTemp, 1,
+                                           false, j); // TB3
+          }
+        }
+      }
+    }
+
+    // --------------------------------------------------------------------
+    // E6, E7, E8, TE6, TE7, TE8
+    if (i >= 4 && i <= 7) {
+      AnToEn_AnToTEn(pathTemp, linkableVertices);
+    }
+
+    // --------------------------------------------------------------------
+    // Bn, F4 et Hn, TG2, TCn et TF4
+    if (i >= 1) {
+      for (j = 0; j < verticesCount;
+           j++) // on regarde si on peut prolonger la chaîne de 1 avec une arête
+                // de poids 4
+      {
+        /*
+         * 	Le premier paquet de conditions donne:
+         * 		Prolonger par une arrête de poids 4 --> Cn ; sphérique
+         * 		Prolonger par une arrête de poids 5 si (2 ou 3 sommets)
+         * --> (H3 ou H4) ; sphérique Prolonger par une arrête de poids 6 --> [
+         * 3, 6 ] ; euclidien
+         */
+        if (((coxeterMatrix[path[i]][j] == 4) ||
+             (coxeterMatrix[path[i]][j] == 5 && (i == 1 || i == 2)) ||
+             (coxeterMatrix[path[i]][j] == 6 && i == 1)) &&
+            linkableVertices_0_nMin1[j]) {
+          iOrder = coxeterMatrix[path[i]][j];
+          linkableVerticesTemp = linkableVertices;
+          for (k = 0; k < verticesCount; k++) {
+            if (coxeterMatrix[k][j] != 2)
+              linkableVerticesTemp[k] = false;
+          }
+
+          if (coxeterMatrix[path[i]][j] < 6) // sphérique
+            graphsList_spherical->addGraph(pathTemp, linkableVerticesTemp,
+                                           (iOrder == 4 ? 1 : 7), true, j);
+          else
+            graphsList_euclidean->addGraph(pathTemp, linkableVerticesTemp, 6,
+                                           false, j, 0, 1);
+
+          auto linkableVerticesTemp_bck(
+              linkableVerticesTemp); // Contains info for: pathTemp + j
+
+          // ------------------------------------------
+          // on va tenter de prolonger cela en un TCn, n \geq 3
+          if (coxeterMatrix[path[i]][j] == 4) {
+            for (k = 0; k < verticesCount; k++) {
+              if (coxeterMatrix[k][pathTemp[0]] == 4 && k != j &&
+                  linkableVertices_1_n[k] && coxeterMatrix[k][j] == 2) {
+                // Additional info for vertex k
+                for (l = 0; l < verticesCount; l++) {
+                  if (coxeterMatrix[k][l] != 2)
+                    linkableVerticesTemp[l] = false;
+                }
+
+                graphsList_euclidean->addGraph(pathTemp, linkableVerticesTemp,
+                                               2, false, k, j);
+
+                linkableVerticesTemp =
+                    linkableVerticesTemp_bck; // Restoring to info of pathTemp
+                                              // and j
+              }
+            }
+          }
+
+          // ------------------------------------------
+          // ici, on a un B3, que l'on va tenter de prolonger en F4 ou un B4 que
+          // l'on va tenter de prolonger en un TF4
+          if ((i == 1 || i == 2) && coxeterMatrix[path[i]][j] == 4)
+            B3ToF4_B4ToTF4(linkableVertices_0_nMin1, pathTemp, j);
+
+        } // if (((coxeterMatrix[ path[i] ][j] == 4) || (coxeterMatrix[
+          // path[i] ][j] == 5 && (i == 1 || i == 2)) || (coxeterMatrix[
+          // path[i] ][j] == 6 && i == 1)) && linkableVertices_0_nMin1[j])
+      }
+    }
+  }
+}
+
+void CoxIter::AnToEn_AnToTEn(const vector<short unsigned int> &pathTemp,
+                             const vector<bool> &linkableVertices) {
+  unsigned int pathSize(pathTemp.size());
+
+  /*
+   * 	2 pour le sommets 3 (i.e. cas sphérique: E6, E7, E8 ou car euclidien
+   * \tilde E8) 3 pour le sommet 4 (i.e. cas euclidien: \tilde E7)
+   */
+
+  bool isSpherical(pathSize <= 7 ? true : false);
+  unsigned int iStart(isSpherical || pathSize == 8 ? 2 : 3);
+
+  // E6, E7, E8, \tilde E8
+  AnToEn_AnToTEn(pathTemp, linkableVertices, isSpherical, iStart);
+
+  if (pathSize == 7) // \tile E7
+    AnToEn_AnToTEn(pathTemp, linkableVertices, false, 3);
+}
+
+void CoxIter::AnToEn_AnToTEn(const vector<short unsigned int> &pathTemp,
+                             const vector<bool> &linkableVertices,
+                             const bool &isSpherical,
+                             const short unsigned int &start) {
+  unsigned int pathSize(pathTemp.size()), j, k, l;
+  vector<bool> linkableVerticesTemp, linkableVerticesTempTemp;
+
+  /*
+   * 	Ici, on a donc un An (n=5, 6 ou 7) avec 1 -- 2 -- 3 -- 4 -- 5 ...
+   * 	On va cherche si iStart a un voisin admissible
+   */
+  for (unsigned int i(0); i < verticesCount; i++) {
+    // si le sommet est pas utilisbale (s'il l'est c'est qu'il n'est pas voisin
+    // de la base) ET si y'a un lien
+    if (false == linkableVertices[i] &&
+        coxeterMatrix[i][pathTemp[start]] == 3) {
+      // on va chercher si c'est uniquement à cause d'un des sommets différents
+      // de iStart que le sommet n'est pas admissible
+      for (j = 0; j < pathSize; j++) {
+        if (j != start && coxeterMatrix[pathTemp[j]][i] != 2)
+          break;
+      }
+
+      if (j == pathSize) // admissible
+      {
+        linkableVerticesTemp = linkableVertices;
+        for (k = 0; k < verticesCount; k++) {
+          if (coxeterMatrix[i][k] != 2)
+            linkableVerticesTemp[k] = false;
+        }
+
+        if (isSpherical) {
+          graphsList_spherical->addGraph(pathTemp, linkableVerticesTemp, 4,
+                                         true, i); // En
+
+          // on a un E6 qu'on va tenter de prolonger en un TE6
+          if (pathSize == 5) {
+            for (j = 0; j < verticesCount; j++) {
+              if (coxeterMatrix[i][j] == 3 && linkableVertices[j]) {
+                linkableVerticesTempTemp = linkableVerticesTemp;
+                for (l = 0; l < verticesCount; l++) {
+                  if (coxeterMatrix[j][l] != 2)
+                    linkableVerticesTempTemp[l] = false;
+                }
+
+                graphsList_euclidean->addGraph(
+                    pathTemp, linkableVerticesTempTemp, 4, false, i, j); // En
+              }
+            }
+          }
+        } else
+          graphsList_euclidean->addGraph(pathTemp, linkableVerticesTemp, 4,
+                                         false, i); // TEn
+      }
+    }
+  }
+}
+
+/*
+ * 	B3ToF4_B4ToTF4
+ * 		On tente de prolonger un B3 en un F4 ou un B4 en \tilde F4
+ * (euclidien)
+ * 										                  4
+ * 			Le B3 donné est: pathTemp[0] --------- pathTemp[1]
+ * ------------ endVertex
+ *
+ * 			Le B4 donné est: pathTemp[0] --------- pathTemp[1]
+ * ------------ pathTemp[2] ------------ endVertex
+ * 													            4
+ *
+ * 		Paramètres:
+ * 			linkableVerticesStart: ce qui est linkable à cause du
+ * premier (deux premiers) sommet(s) pathTemp: deux(trois) premiers sommets
+ * endVertex: 3ème(4ème) sommet
+ * */
+void CoxIter::B3ToF4_B4ToTF4(const vector<bool> &linkableVerticesStart,
+                             vector<short unsigned int> pathTemp,
+                             const short unsigned int &endVertex) {
+  bool isSpherical(pathTemp.size() == 2); // true si sphérique (on cherche F4),
+                                          // false si euclidien (on cherche TF4)
+  unsigned int i, j, v2(pathTemp[1]);
+  vector<bool> linkableVertices;
+
+  pathTemp.push_back(endVertex);
+
+  // on va parcourir les sommets et regarder les voisins de poids 3 de endVertex
+  for (i = 0; i < verticesCount; i++) {
+    if (coxeterMatrix[endVertex][i] == 3 && linkableVerticesStart[i] &&
+        coxeterMatrix[i][v2] == 2) {
+      linkableVertices = linkableVerticesStart;
+
+      if (!isSpherical &&
+          coxeterMatrix[pathTemp[2]][i] !=
+              2) // If i is connected to pathTemp[2], this won't work
+        continue;
+
+      for (j = 0; j < verticesCount; j++) {
+        if (coxeterMatrix[j][v2] != 2 ||
+            coxeterMatrix[j][endVertex] != 2 ||
+            coxeterMatrix[j][i] != 2 ||
+            (!isSpherical && coxeterMatrix[j][pathTemp[2]] != 2))
+          linkableVertices[j] = false;
+      }
+
+      if (isSpherical)
+        graphsList_spherical->addGraph(pathTemp, linkableVertices, 5, true,
+                                       i); // Fn
+      else
+        graphsList_euclidean->addGraph(pathTemp, linkableVertices, 5, false,
+                                       i); // TFn
+    }
+  }
+}
+
+void CoxIter::printPath() {
+  if (path.size() == 1)
+    return;
+
+  for (const auto &p : path)
+    *out << p << " ; ";
+
+  *out << endl;
+}
+
+/*! 	\fn vector2str
+ * 	\brief Vector --> string
+ * 	\param polynomial(const vector< mpz_class >& polynomial) Polynomial
+ *
+ * 	\remark: When mpz_class will have a to_string(mpz) we'll move that to
+ * tools/polynomials.h TODO
+ */
+string vector2str(const vector<mpz_class> &polynomial) {
+  bool isFirst(true);
+  unsigned int size(polynomial.size());
+  string result;
+  mpz_class mpzTemp;
+
+  for (unsigned int i(0); i < size; i++) {
+    if (polynomial[i] != 0) {
+      if (isFirst) {
+        result += polynomial[i].get_str() +
+                  (i ? " * x" + string(i > 1 ? "^" + to_string(i) : "") : "");
+        isFirst = false;
+      } else {
+        if ((polynomial[i] != 1 && polynomial[i] != -1) || !i) {
+          mpzTemp = abs(polynomial[i]);
+          result += (polynomial[i] > 0 ? " + " : " - ") + mpzTemp.get_str() +
+                    (i ? " * x" + string(i > 1 ? "^" + to_string(i) : "") : "");
+        } else
+          result += (polynomial[i] > 0 ? " + " : " - ") +
+                    string(i > 1 ? "x^" + to_string(i) : "x");
+      }
+    }
+  }
+
+  return result;
+}
+
+const vector<vector<GraphsProductSet>> *
+CoxIter::get_ptr_graphsProducts() const {
+  return &graphsProducts;
+}
+
+const vector<Graph *> &CoxIter::get_graphsById() const { return graphsById; }
+
+string CoxIter::get_growthSeries_raw() {
+  string growth;
+
+  if (ouputMathematicalFormat == "generic") {
+    growth = "g(x) = (" + growthSeries_raw + ")^-1;";
+  } else if (ouputMathematicalFormat == "mathematica") {
+    growth = "Symb[s_, x_] := Product[Sum[x^i, {i, 0, s[[i]] - 1}], {i, 1, "
+             "Length[s]}];\n";
+    growth += "g[x_] := (" + growthSeries_raw + ")^-1;";
+  } else if (ouputMathematicalFormat == "pari") {
+    growth = "Symb = (S, y) -> prod(i=1, length(S), sum(i=0,S[i]-1,y^i));\n";
+    growth += "g(x) = (" + growthSeries_raw + ")^-1;";
+  }
+
+  return growth;
+}
+
+string CoxIter::get_growthSeries() {
+  string growth;
+
+  if (ouputMathematicalFormat == "generic") {
+    growth = "f(x) = ";
+    if (growthSeries_cyclotomicNumerator.size()) {
+      growth += "C(";
+      unsigned int max(growthSeries_cyclotomicNumerator.size());
+      for (unsigned int i(0); i < max; i++)
+        growth +=
+            (i ? "," : "") + to_string(growthSeries_cyclotomicNumerator[i]);
+
+      growth += ")";
+    }
+
+    growth += "/(" + vector2str(growthSeries_polynomialDenominator) + ")";
+  } else if (ouputMathematicalFormat == "gap") {
+    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+    unsigned int denominatorSize(growthSeries_polynomialDenominator.size());
+
+    growth += "f := Product([";
+    for (unsigned int i(0); i < cycloSize; i++)
+      growth += (i ? "," : "") + to_string(growthSeries_cyclotomicNumerator[i]);
+
+    growth += "], i -> CyclotomicPolynomial(Rationals,i))/ValuePol([";
+    for (unsigned int i(0); i < denominatorSize; i++)
+      growth +=
+          (i ? "," : "") + growthSeries_polynomialDenominator[i].get_str();
+
+    growth += "], X(Rationals));";
+  } else if (ouputMathematicalFormat == "mathematica") {
+    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+
+    growth =
+        "Cyclo[s_, x_] := Product[Cyclotomic[s[[i]], x], {i, 1, Length[s]}];";
+
+    growth += "f[x_] := Cyclo[{";
+    for (unsigned int i(0); i < cycloSize; i++)
+      growth += (i ? "," : "") + to_string(growthSeries_cyclotomicNumerator[i]);
+
+    growth += "},x]/(" + vector2str(growthSeries_polynomialDenominator) + ");";
+  } else if (ouputMathematicalFormat == "pari") {
+    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+    growth = "Cyclo = (S, y) -> prod(i=1, length(S), polcyclo(S[i],y));\n";
+    growth += "f(x) = Cyclo([";
+    for (unsigned int i(0); i < cycloSize; i++)
+      growth += (i ? "," : "") + to_string(growthSeries_cyclotomicNumerator[i]);
+
+    growth += "],x)/(" + vector2str(growthSeries_polynomialDenominator) + ");";
+  }
+
+  return growth;
+}
+
+void CoxIter::printGrowthSeries() {
+  if (!isGrowthSeriesComputed)
+    growthSeries();
+
+  if (ouputMathematicalFormat == "generic") {
+    *out << "f(x) = ";
+    if (growthSeries_cyclotomicNumerator.size()) {
+      *out << "C(";
+      unsigned int max(growthSeries_cyclotomicNumerator.size());
+      for (unsigned int i(0); i < max; i++)
+        *out << (i ? "," : "") << growthSeries_cyclotomicNumerator[i];
+
+      *out << ")";
+    }
+
+    *out << "/(";
+    Polynomials::polynomialDisplay(growthSeries_polynomialDenominator, *out);
+    *out << ")";
+
+    if (debug)
+      *out << "\ng(x) = (" << growthSeries_raw << ")^-1;";
+  } else if (ouputMathematicalFormat == "gap") {
+    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+    unsigned int denominatorSize(growthSeries_polynomialDenominator.size());
+
+    *out << "f := Product([";
+    for (unsigned int i(0); i < cycloSize; i++)
+      *out << (i ? "," : "") << growthSeries_cyclotomicNumerator[i];
+
+    *out << "], i -> CyclotomicPolynomial(Rationals,i))/ValuePol([";
+    for (unsigned int i(0); i < denominatorSize; i++)
+      *out << (i ? "," : "") << growthSeries_polynomialDenominator[i];
+
+    *out << "], X(Rationals));";
+
+    if (debug)
+      *out << "\ng(x) = (" << growthSeries_raw << ")^-1;";
+  } else if (ouputMathematicalFormat == "mathematica") {
+    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+
+    *out
+        << "Cyclo[s_, x_] := Product[Cyclotomic[s[[i]], x], {i, 1, Length[s]}];"
+        << endl;
+    if (debug)
+      *out << "Symb[s_, x_] := Product[Sum[x^i, {i, 0, s[[i]] - 1}], {i, 1, "
+              "Length[s]}];"
+           << endl;
+
+    *out << "f[x_] := Cyclo[{";
+    for (unsigned int i(0); i < cycloSize; i++)
+      *out << (i ? "," : "") << growthSeries_cyclotomicNumerator[i];
+    *out << "},x]";
+
+    *out << "/(";
+    Polynomials::polynomialDisplay(growthSeries_polynomialDenominator, *out);
+    *out << ");";
+
+    if (debug)
+      *out << "\ng[x_] := (" << growthSeries_raw << ")^-1;";
+  } else if (ouputMathematicalFormat == "pari") {
+    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+
+    *out << "Cyclo = (S, y) -> prod(i=1, length(S), polcyclo(S[i],y));" << endl;
+    if (debug)
+      *out << "Symb = (S, y) -> prod(i=1, length(S), sum(i=0,S[i]-1,y^i));"
+           << endl;
+
+    *out << "f(x) = Cyclo([";
+    for (unsigned int i(0); i < cycloSize; i++)
+      *out << (i ? "," : "") << growthSeries_cyclotomicNumerator[i];
+    *out << "],x)/(";
+    Polynomials::polynomialDisplay(growthSeries_polynomialDenominator, *out);
+    *out << ");";
+
+    if (debug)
+      *out << "\ng(x) = (" << growthSeries_raw << ")^-1;";
+  }
+}
+
+ostream &operator<<(ostream &o, const CoxIter &g) {
+  o << "Graphes sphériques: " << endl;
+  o << *g.graphsList_spherical;
+
+  o << "Graphes euclidien: " << endl;
+  o << *g.graphsList_euclidean;
+
+  return o;
+}
+
+int CoxIter::isGraphCocompact() {
+  if (isCocompact >= 0)
+    return isCocompact;
+
+  StageTimer timer(stats.cocompactnessTime);
+
+  if (!isGraphsProductsComputed)
+    computeGraphsProducts();
+
+  if (!checkCocompactness || !graphsProducts.size()) {
+    isCocompact = -1;
+    return -1;
+  }
+
+  if (!graphsProducts_size(1) ||
+      !graphsProducts_size(0)) // No vertices, no edges
+  {
+    isCocompact = 0;
+    return 0;
+  }
+
+  if (hasBoldLine) {
+    isCocompact = 0;
+    return 0;
+  }
+
+  // ----------------------------------------------------
+  // the test
+  if (isCheckStreamed)
+    isCocompact = isGraph_cocompact_finiteVolume_streamed(1) ? 1 : 0;
+  else if (isGraphsProductsIds)
+    isCocompact = isGraph_cocompact_finiteVolume_ids(1) ? 1 : 0;
+  else if (useOpenMP && verticesCount >= 15)
+    isCocompact = isGraph_cocompact_finiteVolume_parallel(1) ? 1 : 0;
+  else
+    isCocompact = isGraph_cocompact_finiteVolume_sequential(1) ? 1 : 0;
+
+  return isCocompact;
+}
+
+void CoxIter::computeCyclicProducts() {
+  if (isCyclicProductsComputed)
+    return;
+
+  unsigned int i, j, k;
+
+  // Generator of Q(cos(pi/m)), m >= 4
+  auto fieldGenerator = [](const unsigned int &m) -> string {
+    if (m == 4)
+      return "sqrt(2)";
+    else if (m == 5)
+      return "sqrt(5)";
+    else if (m == 6)
+      return "sqrt(3)";
+    else
+      return "cos(pi/" + to_string(m) + ")";
+  };
+
+  // ---------------------------------------------------------------------------
+  // Spanning forest (without the dotted edges)
+  vector<int> parents(verticesCount, -1);
+  vector<unsigned int> queue;
+
+  for (i = 0; i < verticesCount; i++) {
+    if (parents[i] != -1)
+      continue;
+
+    parents[i] = i;
+    queue = vector<unsigned int>(1, i);
+
+    for (k = 0; k < queue.size(); k++) {
+      for (j = 0; j < verticesCount; j++) {
+        if (coxeterMatrix[queue[k]][j] != 2 &&
+            coxeterMatrix[queue[k]][j] != 1 && parents[j] == -1) {
+          parents[j] = queue[k];
+          queue.push_back(j);
+        }
+      }
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Fundamental cycles: one for each edge which is not in the forest
+  set<unsigned int> edgesOrders;
+  cyclicProducts.clear();
+
+  for (i = 0; i < verticesCount; i++) {
+    for (j = i + 1; j < verticesCount; j++) {
+      if (coxeterMatrix[i][j] == 2)
+        continue;
+
+      edgesOrders.insert(coxeterMatrix[i][j]);
+
+      if (coxeterMatrix[i][j] == 1 || parents[i] == static_cast<int>(j) ||
+          parents[j] == static_cast<int>(i))
+        continue;
+
+      // Paths to the root and then to the closest common ancestor
+      vector<unsigned int> pathI(1, i), pathJ(1, j);
+      while (parents[pathI.back()] != static_cast<int>(pathI.back()))
+        pathI.push_back(parents[pathI.back()]);
+      while (parents[pathJ.back()] != static_cast<int>(pathJ.back()))
+        pathJ.push_back(parents[pathJ.back()]);
+
+      while (pathI.size() > 1 && pathJ.size() > 1 &&
+             pathI[pathI.size() - 2] == pathJ[pathJ.size() - 2]) {
+        pathI.pop_back();
+        pathJ.pop_back();
+      }
+
+      pathJ.pop_back();
+      pathI.insert(pathI.end(), pathJ.rbegin(), pathJ.rend());
+
+      CyclicProduct cyclicProduct;
+      cyclicProduct.cycle = pathI;
+
+      for (k = 0; k < pathI.size(); k++) {
+        unsigned int v(pathI[k]), w(pathI[(k + 1) % pathI.size()]);
+        cyclicProduct.orders[coxeterMatrix[v][w]]++;
+      }
+
+      cyclicProducts.push_back(cyclicProduct);
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Field generated by the entries of the Gram matrix
+  gramMatrixField = "";
+  isGramMatrixFieldKnown = !edgesOrders.count(1);
+
+  if (isGramMatrixFieldKnown) {
+    for (const auto &order : edgesOrders) {
+      if (order >= 4)
+        gramMatrixField +=
+            (gramMatrixField == "" ? "" : ", ") + fieldGenerator(order);
+    }
+
+    gramMatrixField =
+        gramMatrixField == "" ? "Q" : ("Q[" + gramMatrixField + "]");
+  }
+
+  // ---------------------------------------------------------------------------
+  // Field generated by the cyclic products
+  cyclicProductsField = "";
+
+  if (isGramMatrixFieldKnown) {
+    vector<string> generators;
+
+    /*
+     * Cycles of length 2: 4 * cos(pi/m)^2 generates Q(cos(2 * pi/m)), which is
+     * Q(cos(pi/m)) if m is odd and Q(cos(pi/(m/2)) otherwise
+     */
+    for (const auto &order : edgesOrders) {
+      unsigned int m(order % 2 ? order : order / 2);
+
+      if (order >= 4 && m >= 4 &&
+          find(generators.begin(), generators.end(), fieldGenerator(m)) ==
+              generators.end())
+        generators.push_back(fieldGenerator(m));
+    }
+
+    /*
+     * Fundamental cycles: the squares are already in the field and cos(pi/m)
+     * lies in Q(cos(2 * pi/m)) if m is odd. Hence, we only keep the even
+     * orders which appear an odd number of times.
+     */
+    for (const auto &cyclicProduct : cyclicProducts) {
+      vector<unsigned int> oddOrders;
+      for (const auto &order : cyclicProduct.orders) {
+        if (order.first >= 4 && !(order.first % 2) && (order.second % 2))
+          oddOrders.push_back(order.first);
+      }
+
+      if (oddOrders.empty())
+        continue;
+
+      string generator;
+      if (oddOrders == vector<unsigned int>({4, 6}))
+        generator = "sqrt(6)";
+      else {
+        for (const auto &order : oddOrders)
+          generator += (generator == "" ? "" : "*") + fieldGenerator(order);
+      }
 
-  // sommets que l'on ne peut pas lier au graphe (1 --> n), sommets que l'on ne
-  // peut pas lier au graphe (1 --> n-1), , sommets que l'on ne peut pas lier au
-  // graphe (2 --> n)
-  vector<bool> linkableVertices_1_n(verticesCount, true),
-      linkableVertices_1_nMin1(verticesCount, true),
-      linkableVertices_2_n(verticesCount, true);
+      if (find(generators.begin(), generators.end(), generator) ==
+          generators.end())
+        generators.push_back(generator);
+    }
 
-  // vecteur temporaire
-  vector<bool> linkableVerticesTemp, linkableVerticesTempTemp;
+    cyclicProductsField =
+        generators.empty() ? "Q" : ("Q[" + implode(", ", generators) + "]");
+  }
 
-  // chemin en cours de construction
-  vector<short unsigned int> pathTemp;
+  isCyclicProductsComputed = true;
+}
 
-  // i, j, k, l: variables de boucles
-  short unsigned int i, j, k, l, max(path.size()), iOrder;
+array<unsigned int, 3>
+CoxIter::gramMatrixSignature(const unsigned int &galoisConjugate) const {
+  array<unsigned int, 3> signature = {{0, 0, 0}};
+  const long double pi(acosl(-1.0L));
+  unsigned int i, j, k;
 
-  for (i = 0; i < max; i++) {
-    pathTemp.push_back(path[i]);
+  // ---------------------------------------------------------------------------
+  // Conjugate of the Gram matrix
+  vector<vector<long double>> gramMatrix(
+      verticesCount, vector<long double>(verticesCount, 0));
 
-    // --------------------------------------------------------------------
-    // mise à jour des voisinages occupés
-    for (j = 0; j < verticesCount; j++) {
-      if (coxeterMatrix[path[i]][j] != 2)
-        linkableVertices[j] = false;
+  for (i = 0; i < verticesCount; i++) {
+    gramMatrix[i][i] = 1;
 
-      if (i >= 1 && coxeterMatrix[path[i]][j] != 2)
-        linkableVertices_1_n[j] = false;
+    for (j = 0; j < i; j++) {
+      if (coxeterMatrix[i][j] == 1)
+        throw(string("CoxIter::gramMatrixSignature: The graph contains dotted "
+                     "edges"));
+      else if (coxeterMatrix[i][j] == 0)
+        gramMatrix[i][j] = -1;
+      else if (coxeterMatrix[i][j] != 2)
+        gramMatrix[i][j] = -cosl(galoisConjugate * pi / coxeterMatrix[i][j]);
 
-      if (i >= 2 && coxeterMatrix[path[i]][j] != 2)
-        linkableVertices_2_n[j] = false;
+      gramMatrix[j][i] = gramMatrix[i][j];
+    }
+  }
 
-      if (i >= 1 && coxeterMatrix[path[i - 1]][j] != 2)
-        linkableVertices_0_nMin1[j] = false;
+  // ---------------------------------------------------------------------------
+  // Eigenvalues: Jacobi method
+  for (unsigned int sweep(0); sweep < 100; sweep++) {
+    long double offDiagonal(0);
+    for (i = 0; i < verticesCount; i++) {
+      for (j = i + 1; j < verticesCount; j++)
+        offDiagonal += gramMatrix[i][j] * gramMatrix[i][j];
+    }
 
-      if (i >= 2 && coxeterMatrix[path[i - 1]][j] != 2)
-        linkableVertices_1_nMin1[j] = false;
+    if (offDiagonal < 1e-40L)
+      break;
 
-      if (i >= 2 && coxeterMatrix[path[i - 2]][j] != 2)
-        linkableVertices_0_nMin2[j] = false;
+    for (i = 0; i < verticesCount; i++) {
+      for (j = i + 1; j < verticesCount; j++) {
+        if (gramMatrix[i][j] == 0)
+          continue;
+
+        long double theta((gramMatrix[j][j] - gramMatrix[i][i]) /
+                          (2 * gramMatrix[i][j]));
+        long double t((theta >= 0 ? 1 : -1) /
+                      (fabsl(theta) + sqrtl(theta * theta + 1)));
+        long double c(1 / sqrtl(t * t + 1)), s(t * c);
+
+        for (k = 0; k < verticesCount; k++) {
+          long double aki(gramMatrix[k][i]), akj(gramMatrix[k][j]);
+          gramMatrix[k][i] = c * aki - s * akj;
+          gramMatrix[k][j] = s * aki + c * akj;
+        }
+
+        for (k = 0; k < verticesCount; k++) {
+          long double aik(gramMatrix[i][k]), ajk(gramMatrix[j][k]);
+          gramMatrix[i][k] = c * aik - s * ajk;
+          gramMatrix[j][k] = s * aik + c * ajk;
+        }
+      }
     }
+  }
 
-    // --------------------------------------------------------------------
-    // An
-    if (i != 0) // on ajoute pas les sommets
-      graphsList_spherical->addGraph(pathTemp, linkableVertices, 0, true);
+  for (i = 0; i < verticesCount; i++) {
+    if (fabsl(gramMatrix[i][i]) < 1e-10L)
+      signature[2]++;
+    else if (gramMatrix[i][i] < 0)
+      signature[1]++;
+    else
+      signature[0]++;
+  }
 
-    // --------------------------------------------------------------------
-    // TAn, n >= 2
-    if (i >= 1) {
-      linkableVertices_1_nMin1[pathTemp[i - 1]] = false;
+  return signature;
+}
 
-      for (j = 0; j < verticesCount; j++) {
-        // si la partie centrale ne pose pas de problème ET qu'on est lié à
-        // chaque extrémité
-        if (linkableVertices_1_nMin1[j] && !linkableVertices[j] &&
-            coxeterMatrix[j][pathTemp[0]] == 3 &&
-            coxeterMatrix[j][pathTemp[i]] == 3) {
-          // mise à jour des linkables avec le somme trouvé
-          linkableVerticesTemp = linkableVertices;
-          for (k = 0; k < verticesCount; k++) {
-            if (coxeterMatrix[k][j] != 2)
-              linkableVerticesTemp[k] = false;
-          }
+int CoxIter::checkCovolumeFiniteness() {
+  if (isFiniteCovolume >= 0)
+    return isFiniteCovolume;
 
-          graphsList_euclidean->addGraph(
-              pathTemp, linkableVerticesTemp, 0, false, j, 0,
-              1); // TODO OPTIMIZATION modifier ce 1 (relatif à une meilleure
-                  // valeur que "0" par défaut pour les dernières variables)
+  StageTimer timer(stats.finiteCovolumeTime);
+
+  if (!isGraphsProductsComputed)
+    computeGraphsProducts();
+
+  // ----------------------------------------------------
+  // some stupid tests
+  if (!graphsProducts.size()) {
+    isFiniteCovolume = -1;
+    return -1;
+  }
+
+  if (!graphsProducts_size(2) && !graphsProducts_size(1)) // No vertices
+  {
+    isFiniteCovolume = 0;
+    return 0;
+  }
+
+  if (!graphsProducts_size(0)) // No edges
+  {
+    isFiniteCovolume = 0;
+    return 0;
+  }
+
+  /*
+   * The duplication of the data is not beautiful but it allows
+   * us to simplify the code of the function isGraph_cocompact_finiteVolume.
+   * Moreover, we want the program to be quick but memory is not really an
+   * issue.
+   *
+   * [2] Contains a combined list of finite and infinite vertices
+   */
+  graphsProducts[2].insert(graphsProducts[2].end(), graphsProducts[1].begin(),
+                           graphsProducts[1].end());
+
+  // ----------------------------------------------------
+  // the test
+  if (isCheckStreamed)
+    isFiniteCovolume = isGraph_cocompact_finiteVolume_streamed(2) ? 1 : 0;
+  else if (isGraphsProductsIds)
+    isFiniteCovolume = isGraph_cocompact_finiteVolume_ids(2) ? 1 : 0;
+  else if (useOpenMP && verticesCount >= 15)
+    isFiniteCovolume = isGraph_cocompact_finiteVolume_parallel(2) ? 1 : 0;
+  else
+    isFiniteCovolume = isGraph_cocompact_finiteVolume_sequential(2) ? 1 : 0;
+
+  return isFiniteCovolume;
+}
+
+bool CoxIter::isGraph_cocompact_finiteVolume_sequential(unsigned int index) {
+  unsigned int extendedCount;
+
+  vector<unsigned int> diffSubNotBig, diffBigNotSub;
+  vector<unsigned int>::const_iterator itGBig;
+
+  bool isExtendable;
+
+  for (const auto &sphericalProductsCodim1 : graphsProducts[0]) {
+    extendedCount = 0;
+    stats.extensionTestsCount += graphsProducts[index].size();
+
+    for (const auto &gpBig : graphsProducts[index]) {
+      diffSubNotBig.clear();
+      diffBigNotSub.clear();
+
+      set_difference(sphericalProductsCodim1.begin(),
+                     sphericalProductsCodim1.end(), gpBig.begin(), gpBig.end(),
+                     back_inserter(diffSubNotBig));
+
+      set_difference(gpBig.begin(), gpBig.end(),
+                     sphericalProductsCodim1.begin(),
+                     sphericalProductsCodim1.end(),
+                     back_inserter(diffBigNotSub));
+
+      isExtendable = true;
+      for (const auto &graphSub : diffSubNotBig) {
+        for (itGBig = diffBigNotSub.begin(); itGBig != diffBigNotSub.end();
+             ++itGBig) {
+          stats.isSubgraphOfCount++;
+          if (graphsById[graphSub]->isSubgraphOf(graphsById[*itGBig]))
+            break;
+        }
+
+        if (itGBig == diffBigNotSub.end()) {
+          isExtendable = false;
+          break;
         }
       }
+
+      if (isExtendable)
+        extendedCount++;
     }
 
-    // --------------------------------------------------------------------
-    // Dn, TBn, TDn
-    if (i >= 2) {
-      linkableVertices_0_nMin2[pathTemp[i - 2]] = false;
+    if (extendedCount != 2) {
+      if (debug) {
+        *out << "----------------------------------------------------------"
+             << endl;
+        *out << (index == 1 ? "Compactness" : "Finite covolume") << " test"
+             << endl;
+        *out << "Trying to extend the product: " << endl;
+        sphericalProductsCodim1.print(*out, graphsById) << endl;
+        *out << "Succeeded in " << extendedCount << " ways instead of 2"
+             << endl;
 
-      // --------------------------------------------------------------------
-      // Dn, TBn (n >= 4), TDn (n >= 4)
-      // on regarde les voisins de l'avant dernier sommet
-      for (j = 0; j < verticesCount; j++) {
-        // si y'a une arête ET si on est pas déjà dans le chemin ET si pas
-        // interdit ET pas lien entre deux extrémités
-        if (coxeterMatrix[j][pathTemp[i - 1]] == 3 &&
-            (pathTemp[i - 1] != j && pathTemp[i] != j) &&
-            linkableVertices_0_nMin2[j] && coxeterMatrix[j][pathTemp[i]] == 2) {
-          linkableVerticesTemp = linkableVertices;
-          for (k = 0; k < verticesCount; k++) {
-            if (coxeterMatrix[k][j] != 2)
-              linkableVerticesTemp[k] = false;
+        for (vector<GraphsProductSet>::const_iterator gpBig(
+                 graphsProducts[index].begin());
+             gpBig != graphsProducts[index].end(); ++gpBig) {
+          if (sphericalProductsCodim1.areVerticesSubsetOf(*gpBig,
+                                                          graphsById)) {
+            *out << "Candidate: \n";
+            gpBig->print(*out, graphsById) << endl;
           }
+        }
+        *out << "----------------------------------------------------------"
+             << endl;
+      }
 
-          graphsList_spherical->addGraph(pathTemp, linkableVerticesTemp, 3,
-                                         true, j); // Dn
+      return 0;
+    }
+  }
 
-          // --------------------------------------------------------------------
-          // ici, on va tenter de trouver un TD_n (n >= 4) (i.e. prolonger par
-          // une arrête au 2ème sommet)
-          for (k = 0; k < verticesCount; k++) {
-            if (k != pathTemp[0] && k != j && k != pathTemp[i] &&
-                coxeterMatrix[pathTemp[1]][k] == 3 && linkableVertices_2_n[k] &&
-                coxeterMatrix[pathTemp[0]][k] == 2 &&
-                coxeterMatrix[k][j] == 2) {
-              linkableVerticesTempTemp = linkableVerticesTemp;
-              for (l = 0; l < verticesCount; l++) {
-                if (coxeterMatrix[k][l] != 2)
-                  linkableVerticesTempTemp[l] = false;
-              }
+  return 1;
+}
 
-              graphsList_euclidean->addGraph(pathTemp, linkableVerticesTempTemp,
-                                             3, false, k, j); // TDn
-            }
-          }
+bool CoxIter::isGraph_cocompact_finiteVolume_parallel(unsigned int index) {
+  unsigned int extendedCount, max(graphsProducts[0].size()), i;
 
-          // --------------------------------------------------------------------
-          // ici, on va tenter de trouver un TB_n (n >= 4) (i.e. prolonger par
-          // une arête de poids 4 à gauche)
-          for (k = 0; k < verticesCount; k++) {
-            if (coxeterMatrix[pathTemp[0]][k] == 4 && linkableVertices_1_n[k] &&
-                coxeterMatrix[j][k] == 2) {
-              linkableVerticesTempTemp = linkableVerticesTemp;
-              for (l = 0; l < verticesCount; l++) {
-                if (coxeterMatrix[k][l] != 2)
-                  linkableVerticesTempTemp[l] = false;
+  vector<unsigned int> diffSubNotBig, diffBigNotSub;
+  vector<unsigned int>::const_iterator itGBig;
+
+  bool isExtendable, exit(false);
+
+#pragma omp parallel if (useOpenMP && verticesCount >= 15)
+  {
+#pragma omp single nowait
+    {
+      for (i = 0; i < max && !exit; i++) {
+#pragma omp task private(itGBig, isExtendable, diffSubNotBig, diffBigNotSub,   \
+                         extendedCount) shared(max, index, exit)               \
+    firstprivate(i)
+        {
+          extendedCount = 0;
+          unsigned long int isSubgraphOfCount(0);
+
+          for (const auto &gpBig : graphsProducts[index]) {
+            diffSubNotBig.clear();
+            diffBigNotSub.clear();
+            set_difference(graphsProducts[0][i].begin(),
+                           graphsProducts[0][i].end(), gpBig.begin(),
+                           gpBig.end(), back_inserter(diffSubNotBig));
+
+            set_difference(gpBig.begin(), gpBig.end(),
+                           graphsProducts[0][i].begin(),
+                           graphsProducts[0][i].end(),
+                           back_inserter(diffBigNotSub));
+
+            isExtendable = true;
+            for (const auto &graphSub : diffSubNotBig) {
+              for (itGBig = diffBigNotSub.begin();
+                   itGBig != diffBigNotSub.end(); ++itGBig) {
+                isSubgraphOfCount++;
+                if (graphsById[graphSub]->isSubgraphOf(graphsById[*itGBig]))
+                  break;
               }
 
-              graphsList_euclidean->addGraph(pathTemp, linkableVerticesTempTemp,
-                                             1, false, j, k, 1); // TBn
+              if (itGBig == diffBigNotSub.end()) {
+                isExtendable = false;
+                break;
+              }
             }
+
+            if (isExtendable)
+              extendedCount++;
           }
-        }
 
-        // --------------------------------------------------------------------
-        // TB3
-        if (i == 2) {
-          if (coxeterMatrix[pathTemp[1]][j] == 4 &&
-              coxeterMatrix[pathTemp[0]][j] == 2 &&
-              coxeterMatrix[pathTemp[2]][j] == 2) {
-            linkableVerticesTemp = linkableVertices;
-            for (k = 0; k < verticesCount; k++) {
-              if (coxeterMatrix[k][j] != 2)
-                linkableVerticesTemp[k] = false;
+#pragma omp atomic
+          stats.extensionTestsCount += graphsProducts[index].size();
+#pragma omp atomic
+          stats.isSubgraphOfCount += isSubgraphOfCount;
+
+          if (extendedCount != 2) {
+            if (debug) {
+#pragma omp critical
+              {
+                *out << "------------------------------------------------------"
+                        "----"
+                     << endl;
+                *out << (index == 1 ? "Compactness" : "Finite covolume")
+                     << " test" << endl;
+                *out << "Trying to extend the product: " << endl;
+                graphsProducts[0][i].print(*out, graphsById) << endl;
+                *out << "Succeeded in " << extendedCount << " ways instead of 2"
+                     << endl;
+
+                for (const auto &gpBig : graphsProducts[index]) {
+                  if (graphsProducts[0][i].areVerticesSubsetOf(gpBig,
+                                                               graphsById)) {
+                    *out << "Candidate: \n";
+                    gpBig.print(*out, graphsById) << endl;
+                  }
+                }
+                *out << "------------------------------------------------------"
+                        "----"
+                     << endl;
+              }
             }
 
-            graphsList_euclidean->addGraph(pathTemp, linkableVerticesTemp, 1,
-                                           false, j); // TB3
+#pragma omp atomic write
+            exit = true;
           }
         }
+
+        if (exit)
+          break;
       }
     }
+  }
 
-    // --------------------------------------------------------------------
-    // E6, E7, E8, TE6, TE7, TE8
-    if (i >= 4 && i <= 7) {
-      AnToEn_AnToTEn(pathTemp, linkableVertices);
-    }
+  return !exit;
+}
 
-    // --------------------------------------------------------------------
-    // Bn, F4 et Hn, TG2, TCn et TF4
-    if (i >= 1) {
-      for (j = 0; j < verticesCount;
-           j++) // on regarde si on peut prolonger la chaîne de 1 avec une arête
-                // de poids 4
-      {
-        /*
-         * 	Le premier paquet de conditions donne:
-         * 		Prolonger par une arrête de poids 4 --> Cn ; sphérique
-         * 		Prolonger par une arrête de poids 5 si (2 ou 3 sommets)
-         * --> (H3 ou H4) ; sphérique Prolonger par une arrête de poids 6 --> [
-         * 3, 6 ] ; euclidien
-         */
-        if (((coxeterMatrix[path[i]][j] == 4) ||
-             (coxeterMatrix[path[i]][j] == 5 && (i == 1 || i == 2)) ||
-             (coxeterMatrix[path[i]][j] == 6 && i == 1)) &&
-            linkableVertices_0_nMin1[j]) {
-          iOrder = coxeterMatrix[path[i]][j];
-          linkableVerticesTemp = linkableVertices;
-          for (k = 0; k < verticesCount; k++) {
-            if (coxeterMatrix[k][j] != 2)
-              linkableVerticesTemp[k] = false;
-          }
+bool CoxIter::isGraph_cocompact_finiteVolume_ids(unsigned int index) {
+  const GraphsProductArena &productsCodim1(graphsProductsIds[0]);
+  bool exit(false);
+
+  // Vertices of a product (for the debug)
+  auto productVertices = [this](const GraphsProductArena &products,
+                                const size_t &i) {
+    vector<short unsigned int> vertices;
+    for (auto id(products.begin(i)); id != products.end(i); ++id)
+      vertices.insert(vertices.end(), graphsById[*id]->vertices.begin(),
+                      graphsById[*id]->vertices.end());
+
+    sort(vertices.begin(), vertices.end());
+    return vertices;
+  };
+
+#pragma omp parallel for if (useOpenMP && verticesCount >= 15)                 \
+    schedule(dynamic)
+  for (size_t i = 0; i < productsCodim1.size(); i++) {
+    bool exit_;
+#pragma omp atomic read
+    exit_ = exit;
+    if (exit_)
+      continue;
 
-          if (coxeterMatrix[path[i]][j] < 6) // sphérique
-            graphsList_spherical->addGraph(pathTemp, linkableVerticesTemp,
-                                           (iOrder == 4 ? 1 : 7), true, j);
-          else
-            graphsList_euclidean->addGraph(pathTemp, linkableVerticesTemp, 6,
-                                           false, j, 0, 1);
+    vector<unsigned int> diffSubNotBig, diffBigNotSub;
+    vector<unsigned int>::const_iterator itGBig;
+    unsigned int extendedCount(0);
+    unsigned long int isSubgraphOfCount(0), extensionTestsCount(0);
+
+    // [1] for the cocompacity; [1] and [2] for the finite covolume
+    for (unsigned int k(1); k <= index; k++) {
+      const GraphsProductArena &productsBig(graphsProductsIds[k]);
+      extensionTestsCount += productsBig.size();
+
+      for (size_t j(0); j < productsBig.size(); j++) {
+        diffSubNotBig.clear();
+        diffBigNotSub.clear();
+
+        set_difference(productsCodim1.begin(i), productsCodim1.end(i),
+                       productsBig.begin(j), productsBig.end(j),
+                       back_inserter(diffSubNotBig));
+
+        set_difference(productsBig.begin(j), productsBig.end(j),
+                       productsCodim1.begin(i), productsCodim1.end(i),
+                       back_inserter(diffBigNotSub));
+
+        bool isExtendable(true);
+        for (const auto &graphSub : diffSubNotBig) {
+          for (itGBig = diffBigNotSub.begin(); itGBig != diffBigNotSub.end();
+               ++itGBig) {
+            isSubgraphOfCount++;
+            if (graphsById[graphSub]->isSubgraphOf(graphsById[*itGBig]))
+              break;
+          }
 
-          auto linkableVerticesTemp_bck(
-              linkableVerticesTemp); // Contains info for: pathTemp + j
+          if (itGBig == diffBigNotSub.end()) {
+            isExtendable = false;
+            break;
+          }
+        }
 
-          // ------------------------------------------
-          // on va tenter de prolonger cela en un TCn, n \geq 3
-          if (coxeterMatrix[path[i]][j] == 4) {
-            for (k = 0; k < verticesCount; k++) {
-              if (coxeterMatrix[k][pathTemp[0]] == 4 && k != j &&
-                  linkableVertices_1_n[k] && coxeterMatrix[k][j] == 2) {
-                // Additional info for vertex k
-                for (l = 0; l < verticesCount; l++) {
-                  if (coxeterMatrix[k][l] != 2)
-                    linkableVerticesTemp[l] = false;
-                }
+        if (isExtendable)
+          extendedCount++;
+      }
+    }
 
-                graphsList_euclidean->addGraph(pathTemp, linkableVerticesTemp,
-                                               2, false, k, j);
+#pragma omp atomic
+    stats.extensionTestsCount += extensionTestsCount;
+#pragma omp atomic
+    stats.isSubgraphOfCount += isSubgraphOfCount;
 
-                linkableVerticesTemp =
-                    linkableVerticesTemp_bck; // Restoring to info of pathTemp
-                                              // and j
-              }
+    if (extendedCount != 2) {
+      if (debug) {
+#pragma omp critical
+        {
+          const vector<short unsigned int> vertices(
+              productVertices(productsCodim1, i));
+
+          *out << "----------------------------------------------------------"
+               << endl;
+          *out << (index == 1 ? "Compactness" : "Finite covolume") << " test"
+               << endl;
+          *out << "Trying to extend the product: " << endl;
+          for (auto id(productsCodim1.begin(i)); id != productsCodim1.end(i);
+               ++id)
+            *out << *graphsById[*id];
+          *out << endl;
+          *out << "Succeeded in " << extendedCount << " ways instead of 2"
+               << endl;
+
+          for (unsigned int k(1); k <= index; k++) {
+            for (size_t j(0); j < graphsProductsIds[k].size(); j++) {
+              const vector<short unsigned int> verticesBig(
+                  productVertices(graphsProductsIds[k], j));
+              if (!includes(verticesBig.begin(), verticesBig.end(),
+                            vertices.begin(), vertices.end()))
+                continue;
+
+              *out << "Candidate: \n";
+              for (auto id(graphsProductsIds[k].begin(j));
+                   id != graphsProductsIds[k].end(j); ++id)
+                *out << *graphsById[*id];
+              *out << endl;
             }
           }
+          *out << "----------------------------------------------------------"
+               << endl;
+        }
+      }
 
-          // ------------------------------------------
-          // ici, on a un B3, que l'on va tenter de prolonger en F4 ou un B4 que
-          // l'on va tenter de prolonger en un TF4
-          if ((i == 1 || i == 2) && coxeterMatrix[path[i]][j] == 4)
-            B3ToF4_B4ToTF4(linkableVertices_0_nMin1, pathTemp, j);
+#pragma omp atomic write
+      exit = true;
+    }
+  }
 
-        } // if (((coxeterMatrix[ path[i] ][j] == 4) || (coxeterMatrix[
-          // path[i] ][j] == 5 && (i == 1 || i == 2)) || (coxeterMatrix[
-          // path[i] ][j] == 6 && i == 1)) && linkableVertices_0_nMin1[j])
+  return !exit;
+}
+
+bool CoxIter::isGraph_cocompact_finiteVolume_streamed(unsigned int index) {
+  for (const auto &extensions : graphsProductsExtensions) {
+    const unsigned int extendedCount(
+        extensions.second.first +
+        (index == 2 ? extensions.second.second : 0));
+
+    if (extendedCount != 2) {
+      if (debug) {
+        *out << "----------------------------------------------------------"
+             << endl;
+        *out << (index == 1 ? "Compactness" : "Finite covolume") << " test"
+             << endl;
+        *out << "Trying to extend the product with vertices: ";
+        for (const auto &vertex : extensions.first)
+          *out << map_vertices_indexToLabel[vertex] << " ";
+        *out << endl;
+        *out << "Succeeded in " << extendedCount << " ways instead of 2"
+             << endl;
+        *out << "----------------------------------------------------------"
+             << endl;
       }
+
+      return false;
     }
   }
+
+  return true;
 }
 
-void CoxIter::AnToEn_AnToTEn(const vector<short unsigned int> &pathTemp,
-                             const vector<bool> &linkableVertices) {
-  unsigned int pathSize(pathTemp.size());
+void CoxIter::computeGraphsProducts() {
+  if (isGraphsProductsComputed)
+    return;
 
-  /*
-   * 	2 pour le sommets 3 (i.e. cas sphérique: E6, E7, E8 ou car euclidien
-   * \tilde E8) 3 pour le sommet 4 (i.e. cas euclidien: \tilde E7)
-   */
+  StageTimer timer(stats.graphsProductsTime);
 
-  bool isSpherical(pathSize <= 7 ? true : false);
-  unsigned int iStart(isSpherical || pathSize == 8 ? 2 : 3);
+  if (!isGraphExplored)
+    exploreGraph();
 
-  // E6, E7, E8, \tilde E8
-  AnToEn_AnToTEn(pathTemp, linkableVertices, isSpherical, iStart);
+  if (debug) {
+    *out << "Connected spherical graphs" << endl;
+    *out << *this->graphsList_spherical << endl;
+  }
 
-  if (pathSize == 7) // \tile E7
-    AnToEn_AnToTEn(pathTemp, linkableVertices, false, 3);
-}
+  graphsProducts = vector<vector<GraphsProductSet>>(3);
+  vector<bool> gpNonLinkableVertices(vector<bool>(verticesCount, false));
 
-void CoxIter::AnToEn_AnToTEn(const vector<short unsigned int> &pathTemp,
-                             const vector<bool> &linkableVertices,
-                             const bool &isSpherical,
-                             const short unsigned int &start) {
-  unsigned int pathSize(pathTemp.size()), j, k, l;
-  vector<bool> linkableVerticesTemp, linkableVerticesTempTemp;
+  // Memory-bounded mode (the lists are not used otherwise)
+  isGraphsProductsIds = (memoryBounded || streamedCheck) &&
+                        (checkCocompactness || checkCofiniteness);
+  isCheckStreamed = isGraphsProductsIds && streamedCheck && dimension;
+  if (isCheckStreamed)
+    isGraphsProductsIds = false;
 
-  /*
-   * 	Ici, on a donc un An (n=5, 6 ou 7) avec 1 -- 2 -- 3 -- 4 -- 5 ...
-   * 	On va cherche si iStart a un voisin admissible
-   */
-  for (unsigned int i(0); i < verticesCount; i++) {
-    // si le sommet est pas utilisbale (s'il l'est c'est qu'il n'est pas voisin
-    // de la base) ET si y'a un lien
-    if (false == linkableVertices[i] &&
-        coxeterMatrix[i][pathTemp[start]] == 3) {
-      // on va chercher si c'est uniquement à cause d'un des sommets différents
-      // de iStart que le sommet n'est pas admissible
-      for (j = 0; j < pathSize; j++) {
-        if (j != start && coxeterMatrix[pathTemp[j]][i] != 2)
-          break;
-      }
+  graphsProductsIds = vector<GraphsProductArena>(3);
+  graphsProductsExtensions.clear();
+  graphsProductsStreamedCount.fill(0);
+  GraphsProduct gp; ///< Current graphs product
 
-      if (j == pathSize) // admissible
-      {
-        linkableVerticesTemp = linkableVertices;
-        for (k = 0; k < verticesCount; k++) {
-          if (coxeterMatrix[i][k] != 2)
-            linkableVerticesTemp[k] = false;
+  // --------------------------------------------------------------
+  // symétries: un seul graphe connexe par orbite commence les produits
+  vector<vector<unsigned int>> automorphisms;
+  map<vector<short unsigned int>, Graph *> graphsByVertices;
+  vector<Graph *> sphericalRepresentatives, euclideanRepresentatives;
+  vector<unsigned int> sphericalOrbitsSizes, euclideanOrbitsSizes;
+  unordered_map<Graph *, unsigned int> graphsOrbits;
+
+  // The orbits of the products would be needed (see
+  // symmetries_productsOrbits)
+  if (useSymmetries && !isGraphsProductsIds && !isCheckStreamed)
+    automorphisms = get_automorphismsGenerators();
+
+  const bool isSymmetric(
+      !automorphisms.empty() &&
+      symmetries_graphsOrbits(graphsList_spherical, automorphisms,
+                              sphericalRepresentatives, sphericalOrbitsSizes,
+                              graphsOrbits, graphsByVertices) &&
+      symmetries_graphsOrbits(graphsList_euclidean, automorphisms,
+                              euclideanRepresentatives, euclideanOrbitsSizes,
+                              graphsOrbits, graphsByVertices));
+
+  // --------------------------------------------------------------
+  // produits de graphes sphériques
+  GraphsListIterator grIt_spherical(this->graphsList_spherical);
+
+  if (isSymmetric)
+    computeGraphsProducts_representatives(
+        graphsList_spherical, sphericalRepresentatives, sphericalOrbitsSizes,
+        graphsOrbits, &graphsProductsCount_spherical, true);
+  else {
+#pragma omp parallel if (useOpenMP && verticesCount >= 15)
+    {
+#pragma omp single nowait
+      while (grIt_spherical.ptr) {
+#pragma omp task firstprivate(grIt_spherical, gpNonLinkableVertices, gp)
+        {
+          computeGraphsProducts(grIt_spherical, &graphsProductsCount_spherical,
+                                true, gp, gpNonLinkableVertices);
         }
 
-        if (isSpherical) {
-          graphsList_spherical->addGraph(pathTemp, linkableVerticesTemp, 4,
-                                         true, i); // En
+        ++grIt_spherical;
+      }
+    }
+  }
 
-          // on a un E6 qu'on va tenter de prolonger en un TE6
-          if (pathSize == 5) {
-            for (j = 0; j < verticesCount; j++) {
-              if (coxeterMatrix[i][j] == 3 && linkableVertices[j]) {
-                linkableVerticesTempTemp = linkableVerticesTemp;
-                for (l = 0; l < verticesCount; l++) {
-                  if (coxeterMatrix[j][l] != 2)
-                    linkableVerticesTempTemp[l] = false;
-                }
+  // --------------------------------------------------------------
+  // produits de graphes euclidiens
+  if (debug) {
+    *out << "Connected euclidean graphs" << endl;
+    *out << *this->graphsList_euclidean;
+  }
 
-                graphsList_euclidean->addGraph(
-                    pathTemp, linkableVerticesTempTemp, 4, false, i, j); // En
-              }
-            }
-          }
-        } else
-          graphsList_euclidean->addGraph(pathTemp, linkableVerticesTemp, 4,
-                                         false, i); // TEn
+  GraphsListIterator grIt_euclidean(this->graphsList_euclidean);
+
+  if (isSymmetric)
+    computeGraphsProducts_representatives(
+        graphsList_euclidean, euclideanRepresentatives, euclideanOrbitsSizes,
+        graphsOrbits, &graphsProductsCount_euclidean, false);
+  else {
+#pragma omp parallel if (useOpenMP && verticesCount >= 15)
+    {
+#pragma omp single nowait
+      while (grIt_euclidean.ptr) {
+#pragma omp task firstprivate(grIt_euclidean, gpNonLinkableVertices, gp)
+        {
+          computeGraphsProducts(grIt_euclidean, &graphsProductsCount_euclidean,
+                                false, gp, gpNonLinkableVertices);
+        }
+
+        ++grIt_euclidean;
       }
     }
   }
-}
 
-/*
- * 	B3ToF4_B4ToTF4
- * 		On tente de prolonger un B3 en un F4 ou un B4 en \tilde F4
- * (euclidien)
- * 										                  4
- * 			Le B3 donné est: pathTemp[0] --------- pathTemp[1]
- * ------------ endVertex
- *
- * 			Le B4 donné est: pathTemp[0] --------- pathTemp[1]
- * ------------ pathTemp[2] ------------ endVertex
- * 													            4
- *
- * 		Paramètres:
- * 			linkableVerticesStart: ce qui est linkable à cause du
- * premier (deux premiers) sommet(s) pathTemp: deux(trois) premiers sommets
- * endVertex: 3ème(4ème) sommet
- * */
-void CoxIter::B3ToF4_B4ToTF4(const vector<bool> &linkableVerticesStart,
-                             vector<short unsigned int> pathTemp,
-                             const short unsigned int &endVertex) {
-  bool isSpherical(pathTemp.size() == 2); // true si sphérique (on cherche F4),
-                                          // false si euclidien (on cherche TF4)
-  unsigned int i, j, v2(pathTemp[1]);
-  vector<bool> linkableVertices;
+  if (isSymmetric) {
+    symmetries_divideCounts(graphsProductsCount_spherical);
+    symmetries_divideCounts(graphsProductsCount_euclidean);
+  }
 
-  pathTemp.push_back(endVertex);
+  if (debug) {
+    *out << "\nProduct of euclidean graphs" << endl;
+    printEuclideanGraphsProducts(&graphsProductsCount_euclidean);
+  }
 
-  // on va parcourir les sommets et regarder les voisins de poids 3 de endVertex
-  for (i = 0; i < verticesCount; i++) {
-    if (coxeterMatrix[endVertex][i] == 3 && linkableVerticesStart[i] &&
-        coxeterMatrix[i][v2] == 2) {
-      linkableVertices = linkableVerticesStart;
+  isGraphsProductsComputed = true;
 
-      if (!isSpherical &&
-          coxeterMatrix[pathTemp[2]][i] !=
-              2) // If i is connected to pathTemp[2], this won't work
-        continue;
+  // ---------------------------------------------------------
+  // We guess the dimension
+  if (!dimension) {
+    dimension = max(euclideanMaxRankFound + 1, sphericalMaxRankFound);
+    isDimensionGuessed = true;
 
-      for (j = 0; j < verticesCount; j++) {
-        if (coxeterMatrix[j][v2] != 2 ||
-            coxeterMatrix[j][endVertex] != 2 ||
-            coxeterMatrix[j][i] != 2 ||
-            (!isSpherical && coxeterMatrix[j][pathTemp[2]] != 2))
-          linkableVertices[j] = false;
-      }
+    if (euclideanMaxRankFound == sphericalMaxRankFound)
+      graphsProducts_shift();
+    else if (euclideanMaxRankFound > sphericalMaxRankFound) {
+      graphsProducts_clear(0);
+      graphsProducts_clear(1);
+    } else if (sphericalMaxRankFound > euclideanMaxRankFound + 1)
+      graphsProducts_clear(2);
+  }
 
-      if (isSpherical)
-        graphsList_spherical->addGraph(pathTemp, linkableVertices, 5, true,
-                                       i); // Fn
-      else
-        graphsList_euclidean->addGraph(pathTemp, linkableVertices, 5, false,
-                                       i); // TFn
-    }
+  // ---------------------------------------------------------
+  // Symmetries: for the cocompacity and finite covolume tests, one product of
+  // rank n-1 per orbit is enough but we need all the products of rank n
+  if (isSymmetric) {
+    symmetries_productsOrbits(graphsProducts[0], automorphisms,
+                              graphsByVertices, false);
+    symmetries_productsOrbits(graphsProducts[1], automorphisms,
+                              graphsByVertices, true);
+    symmetries_productsOrbits(graphsProducts[2], automorphisms,
+                              graphsByVertices, true);
   }
 }
 
-void CoxIter::printPath() {
-  if (path.size() == 1)
-    return;
+bool CoxIter::removeVertices(const vector<string> &verticesLabels,
+                             CoxIter &ci) {
+  if (&ci == this) {
+    error = "The new graph must be another instance";
+    return false;
+  }
 
-  for (const auto &p : path)
-    cout << p << " ; ";
+  // ---------------------------------------------------------------------------
+  // New indices of the vertices (-1 if removed)
+  vector<int> verticesIndices(verticesCount, 0);
+  for (const auto &label : verticesLabels) {
+    auto it(map_vertices_labelToIndex.find(label));
+    if (it == map_vertices_labelToIndex.end()) {
+      error = "The following vertex is unknown: " + label;
+      return false;
+    }
 
-  cout << endl;
-}
+    verticesIndices[it->second] = -1;
+  }
 
-/*! 	\fn vector2str
- * 	\brief Vector --> string
- * 	\param polynomial(const vector< mpz_class >& polynomial) Polynomial
- *
- * 	\remark: When mpz_class will have a to_string(mpz) we'll move that to
- * tools/polynomials.h TODO
- */
-string vector2str(const vector<mpz_class> &polynomial) {
-  bool isFirst(true);
-  unsigned int size(polynomial.size());
-  string result;
-  mpz_class mpzTemp;
+  unsigned int newVerticesCount(0);
+  for (auto &index : verticesIndices) {
+    if (!index)
+      index = newVerticesCount++;
+  }
 
-  for (unsigned int i(0); i < size; i++) {
-    if (polynomial[i] != 0) {
-      if (isFirst) {
-        result += polynomial[i].get_str() +
-                  (i ? " * x" + string(i > 1 ? "^" + to_string(i) : "") : "");
-        isFirst = false;
-      } else {
-        if ((polynomial[i] != 1 && polynomial[i] != -1) || !i) {
-          mpzTemp = abs(polynomial[i]);
-          result += (polynomial[i] > 0 ? " + " : " - ") + mpzTemp.get_str() +
-                    (i ? " * x" + string(i > 1 ? "^" + to_string(i) : "") : "");
-        } else
-          result += (polynomial[i] > 0 ? " + " : " - ") +
-                    string(i > 1 ? "x^" + to_string(i) : "x");
+  if (!isGraphsProductsComputed)
+    computeGraphsProducts();
+
+  // ---------------------------------------------------------------------------
+  // The new graph
+  removeVertices_graph(verticesIndices, newVerticesCount, ci);
+
+  // ---------------------------------------------------------------------------
+  // Connected subgraphs
+  *ci.graphsList_spherical = *graphsList_spherical;
+  ci.graphsList_spherical->removeVertices(verticesIndices,
+                                          &ci.map_vertices_indexToLabel);
+  *ci.graphsList_euclidean = *graphsList_euclidean;
+  ci.graphsList_euclidean->removeVertices(verticesIndices,
+                                          &ci.map_vertices_indexToLabel);
+  ci.computeGraphsIds();
+  ci.isGraphExplored = true;
+
+  // ---------------------------------------------------------------------------
+  // Products of graphs
+  // Connected graphs which contain a removed vertex: each one starts the
+  // products in which it is the first one (see
+  // computeGraphsProducts_representatives)
+  vector<vector<Graph *>> removedGraphs(2);
+  vector<unordered_map<Graph *, unsigned int>> graphsOrbits(2);
+
+  for (unsigned int k(0); k < 2; k++) {
+    GraphsList *graphsList(k ? graphsList_euclidean : graphsList_spherical);
+
+    for (GraphsListIterator grIt(graphsList); grIt.ptr; ++grIt) {
+      for (const auto &vertex : grIt.ptr->vertices) {
+        if (verticesIndices[vertex] < 0) {
+          graphsOrbits[k][grIt.ptr] = removedGraphs[k].size();
+          removedGraphs[k].push_back(grIt.ptr);
+          break;
+        }
       }
     }
+
+    for (GraphsListIterator grIt(graphsList); grIt.ptr; ++grIt) {
+      if (graphsOrbits[k].find(grIt.ptr) == graphsOrbits[k].end())
+        graphsOrbits[k][grIt.ptr] = removedGraphs[k].size();
+    }
   }
 
-  return result;
-}
+  // If many products contain a removed vertex, it is faster to enumerate the
+  // products of the new graph
+  bool isEnumerationNeeded(
+      6 * (removedGraphs[0].size() + removedGraphs[1].size()) >
+      graphsList_spherical->totalGraphsCount +
+          graphsList_euclidean->totalGraphsCount);
+
+  if ((isDimensionGuessed || useSymmetries || memoryBounded || streamedCheck) &&
+      (checkCocompactness || checkCofiniteness))
+    isEnumerationNeeded = true; // graphsProducts depends on the whole graph
+
+  for (unsigned int i(maximalSubgraphRank + 1); i <= verticesCount; i++) {
+    if (!graphsProductsCount_spherical[i].empty() ||
+        !graphsProductsCount_euclidean[i].empty())
+      isEnumerationNeeded = true; // Not all enumerated
+  }
 
-const vector<vector<GraphsProductSet>> *
-CoxIter::get_ptr_graphsProducts() const {
-  return &graphsProducts;
-}
+  if (isEnumerationNeeded) {
+    ci.computeGraphsProducts();
+    return true;
+  }
 
-string CoxIter::get_growthSeries_raw() {
-  string growth;
+  vector<map<vector<vector<short unsigned int>>, unsigned int>>
+      removedCount_spherical(verticesCount + 1),
+      removedCount_euclidean(verticesCount + 1);
+
+  // Nothing is modified if no graph is removed (see sweepEdgesOrders)
+  if (!removedGraphs[0].empty() || !removedGraphs[1].empty()) {
+    const CoxIter_Stats statsBackup(stats);
+    const bool checkCocompactnessBackup(checkCocompactness),
+        checkCofinitenessBackup(checkCofiniteness);
+    checkCocompactness = checkCofiniteness = false;
+
+    for (unsigned int k(0); k < 2; k++)
+      computeGraphsProducts_representatives(
+          k ? graphsList_euclidean : graphsList_spherical, removedGraphs[k],
+          vector<unsigned int>(removedGraphs[k].size(), 1), graphsOrbits[k],
+          k ? &removedCount_euclidean : &removedCount_spherical, !k);
+
+    checkCocompactness = checkCocompactnessBackup;
+    checkCofiniteness = checkCofinitenessBackup;
+    stats = statsBackup;
+
+    symmetries_divideCounts(removedCount_spherical);
+    symmetries_divideCounts(removedCount_euclidean);
+  }
 
-  if (ouputMathematicalFormat == "generic") {
-    growth = "g(x) = (" + growthSeries_raw + ")^-1;";
-  } else if (ouputMathematicalFormat == "mathematica") {
-    growth = "Symb[s_, x_] := Product[Sum[x^i, {i, 0, s[[i]] - 1}], {i, 1, "
-             "Length[s]}];\n";
-    growth += "g[x_] := (" + growthSeries_raw + ")^-1;";
-  } else if (ouputMathematicalFormat == "pari") {
-    growth = "Symb = (S, y) -> prod(i=1, length(S), sum(i=0,S[i]-1,y^i));\n";
-    growth += "g(x) = (" + growthSeries_raw + ")^-1;";
+  for (unsigned int k(0); k < 2; k++) {
+    const auto &counts(k ? graphsProductsCount_euclidean
+                         : graphsProductsCount_spherical);
+    const auto &removedCounts(k ? removedCount_euclidean
+                                : removedCount_spherical);
+    auto &newCounts(k ? ci.graphsProductsCount_euclidean
+                      : ci.graphsProductsCount_spherical);
+    unsigned int &maxRankFound(k ? ci.euclideanMaxRankFound
+                                 : ci.sphericalMaxRankFound);
+
+    for (unsigned int rank(0); rank <= newVerticesCount; rank++) {
+      for (const auto &count : counts[rank]) {
+        auto it(removedCounts[rank].find(count.first));
+        const unsigned int countNew(
+            count.second - (it == removedCounts[rank].end() ? 0 : it->second));
+
+        if (countNew) {
+          newCounts[rank][count.first] = countNew;
+          maxRankFound = rank;
+        }
+      }
+    }
   }
 
-  return growth;
-}
+  // Products used for the cocompacity and the finite covolume
+  ci.graphsProducts = vector<vector<GraphsProductSet>>(3);
+  unordered_map<Graph *, Graph *> graphsNew;
+  for (unsigned int k(0); k < 2; k++) {
+    GraphsListIterator grIt(k ? graphsList_euclidean : graphsList_spherical);
+    GraphsListIterator grItNew(k ? ci.graphsList_euclidean
+                                 : ci.graphsList_spherical);
+
+    for (; grIt.ptr; ++grIt) {
+      if (all_of(grIt.ptr->vertices.begin(), grIt.ptr->vertices.end(),
+                 [&verticesIndices](const short unsigned int &vertex) {
+                   return verticesIndices[vertex] >= 0;
+                 })) {
+        graphsNew[grIt.ptr] = grItNew.ptr;
+        ++grItNew;
+      }
+    }
+  }
 
-string CoxIter::get_growthSeries() {
-  string growth;
+  for (unsigned int k(0); k < 3; k++) {
+    for (const auto &product : graphsProducts[k]) {
+      vector<unsigned int> ids;
 
-  if (ouputMathematicalFormat == "generic") {
-    growth = "f(x) = ";
-    if (growthSeries_cyclotomicNumerator.size()) {
-      growth += "C(";
-      unsigned int max(growthSeries_cyclotomicNumerator.size());
-      for (unsigned int i(0); i < max; i++)
-        growth +=
-            (i ? "," : "") + to_string(growthSeries_cyclotomicNumerator[i]);
+      for (const auto &id : product) {
+        auto it(graphsNew.find(graphsById[id]));
+        if (it == graphsNew.end() || (k == 2 && graphsById[id]->isSpherical))
+          break;
 
-      growth += ")";
+        ids.push_back(it->second->id);
+      }
+
+      if (ids.size() == product.size())
+        ci.graphsProducts[k].push_back(GraphsProductSet(product.rank, ids));
     }
+  }
 
-    growth += "/(" + vector2str(growthSeries_polynomialDenominator) + ")";
-  } else if (ouputMathematicalFormat == "gap") {
-    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
-    unsigned int denominatorSize(growthSeries_polynomialDenominator.size());
+  if (!ci.dimension) {
+    ci.dimension = max(ci.euclideanMaxRankFound + 1, ci.sphericalMaxRankFound);
+    ci.isDimensionGuessed = true;
+  }
 
-    growth += "f := Product([";
-    for (unsigned int i(0); i < cycloSize; i++)
-      growth += (i ? "," : "") + to_string(growthSeries_cyclotomicNumerator[i]);
+  ci.isGraphsProductsComputed = true;
 
-    growth += "], i -> CyclotomicPolynomial(Rationals,i))/ValuePol([";
-    for (unsigned int i(0); i < denominatorSize; i++)
-      cout << (i ? "," : "") << growthSeries_polynomialDenominator[i];
+  return true;
+}
 
-    cout << "], X(Rationals));";
-  } else if (ouputMathematicalFormat == "mathematica") {
-    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+void CoxIter::removeVertices_graph(const vector<int> &verticesIndices,
+                                   const unsigned int &newVerticesCount,
+                                   CoxIter &ci) const {
+  ci.resetGraph();
+
+  ci.debug = debug;
+  ci.useOpenMP = useOpenMP;
+  ci.useSymmetries = useSymmetries;
+  ci.memoryBounded = memoryBounded;
+  ci.streamedCheck = streamedCheck;
+  ci.checkCocompactness = checkCocompactness;
+  ci.checkCofiniteness = checkCofiniteness;
+  ci.ouputMathematicalFormat = ouputMathematicalFormat;
+  ci.bWriteInfo = bWriteInfo;
+  ci.out = out;
+
+  ci.dimension = isDimensionGuessed ? 0 : dimension;
+  ci.verticesCount = newVerticesCount;
+  ci.initializations();
 
-    growth =
-        "Cyclo[s_, x_] := Product[Cyclotomic[s[[i]], x], {i, 1, Length[s]}];";
+  for (unsigned int i(0); i < verticesCount; i++) {
+    if (verticesIndices[i] < 0)
+      continue;
 
-    growth += "f[x_] := Cyclo[{";
-    for (unsigned int i(0); i < cycloSize; i++)
-      growth += (i ? "," : "") + to_string(growthSeries_cyclotomicNumerator[i]);
+    ci.map_vertices_indexToLabel.push_back(map_vertices_indexToLabel[i]);
+    ci.map_vertices_labelToIndex[map_vertices_indexToLabel[i]] =
+        verticesIndices[i];
 
-    growth += "},x]/(" + vector2str(growthSeries_polynomialDenominator) + ");";
-  } else if (ouputMathematicalFormat == "pari") {
-    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
-    growth = "Cyclo = (S, y) -> prod(i=1, length(S), polcyclo(S[i],y));\n";
-    growth += "f(x) = Cyclo([";
-    for (unsigned int i(0); i < cycloSize; i++)
-      growth += (i ? "," : "") + to_string(growthSeries_cyclotomicNumerator[i]);
+    for (unsigned int j(i + 1); j < verticesCount; j++) {
+      if (verticesIndices[j] < 0)
+        continue;
 
-    growth += "],x)/(" + vector2str(growthSeries_polynomialDenominator) + ");";
+      const unsigned int i1(verticesIndices[i]), i2(verticesIndices[j]);
+      ci.coxeterMatrix[i1][i2] = ci.coxeterMatrix[i2][i1] = coxeterMatrix[i][j];
+
+      if (coxeterMatrix[i][j] == 0)
+        ci.hasBoldLine = true;
+      else if (coxeterMatrix[i][j] == 1) {
+        ci.hasDottedLine = true;
+
+        auto it(
+            weightsDotted.find(linearizationMatrix_index(i, j, verticesCount)));
+        if (it != weightsDotted.end())
+          ci.weightsDotted[linearizationMatrix_index(i1, i2,
+                                                     newVerticesCount)] =
+              it->second;
+        else
+          ci.hasDottedLineWithoutWeight = 1;
+      }
+    }
   }
 
-  return growth;
+  ci.finalizeGraphReading();
 }
 
-void CoxIter::printGrowthSeries() {
-  if (!isGrowthSeriesComputed)
-    growthSeries();
+bool CoxIter::addVertex(const vector<unsigned int> &orders,
+                        const string &label) {
+  if (orders.size() != verticesCount) {
+    error = "The number of orders must be the number of vertices";
+    return false;
+  }
 
-  if (ouputMathematicalFormat == "generic") {
-    cout << "f(x) = ";
-    if (growthSeries_cyclotomicNumerator.size()) {
-      cout << "C(";
-      unsigned int max(growthSeries_cyclotomicNumerator.size());
-      for (unsigned int i(0); i < max; i++)
-        cout << (i ? "," : "") << growthSeries_cyclotomicNumerator[i];
+  const string vertexLabel(label == "" ? to_string(verticesCount + 1) : label);
+  if (map_vertices_labelToIndex.find(vertexLabel) !=
+      map_vertices_labelToIndex.end()) {
+    error = "This vertex already exists: " + vertexLabel;
+    return false;
+  }
 
-      cout << ")";
+  // ---------------------------------------------------------------------------
+  // The graph
+  const unsigned int newVertex(verticesCount);
+
+  // The indices of the weights depend on the number of vertices
+  map<unsigned int, string> weights;
+  for (const auto &weight : weightsDotted)
+    weights[linearizationMatrix_index(
+        linearizationMatrix_row(weight.first, verticesCount),
+        linearizationMatrix_col(weight.first, verticesCount),
+        verticesCount + 1)] = weight.second;
+  weightsDotted = weights;
+
+  verticesCount++;
+
+  for (unsigned int i(0); i < newVertex; i++) {
+    coxeterMatrix[i].push_back(orders[i]);
+
+    if (orders[i] == 0)
+      hasBoldLine = true;
+    else if (orders[i] == 1) {
+      hasDottedLine = true;
+      hasDottedLineWithoutWeight = 1;
     }
+  }
+  coxeterMatrix.push_back(orders);
+  coxeterMatrix.back().push_back(2);
 
-    cout << "/(";
-    Polynomials::polynomialDisplay(growthSeries_polynomialDenominator);
-    cout << ")";
+  map_vertices_indexToLabel.push_back(vertexLabel);
+  map_vertices_labelToIndex[vertexLabel] = newVertex;
 
-    if (debug)
-      cout << "\ng(x) = (" << growthSeries_raw << ")^-1;";
-  } else if (ouputMathematicalFormat == "gap") {
-    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
-    unsigned int denominatorSize(growthSeries_polynomialDenominator.size());
+  visitedVertices = vector<bool>(verticesCount, false);
+  visitedEdges =
+      vector<vector<bool>>(verticesCount, vector<bool>(verticesCount, false));
 
-    cout << "f := Product([";
-    for (unsigned int i(0); i < cycloSize; i++)
-      cout << (i ? "," : "") << growthSeries_cyclotomicNumerator[i];
+  factorials.push_back(factorials.back() * (long int)(verticesCount + 1));
+  powersOf2.push_back(mpz_class(2) * powersOf2.back());
 
-    cout << "], i -> CyclotomicPolynomial(Rationals,i))/ValuePol([";
-    for (unsigned int i(0); i < denominatorSize; i++)
-      cout << (i ? "," : "") << growthSeries_polynomialDenominator[i];
+  graphsProductsCount_spherical.push_back(
+      map<vector<vector<short unsigned int>>, unsigned int>());
+  graphsProductsCount_euclidean.push_back(
+      map<vector<vector<short unsigned int>>, unsigned int>());
 
-    cout << "], X(Rationals));";
+  if (!dimension || isDimensionGuessed)
+    maximalSubgraphRank = verticesCount;
 
-    if (debug)
-      cout << "\ng(x) = (" << growthSeries_raw << ")^-1;";
-  } else if (ouputMathematicalFormat == "mathematica") {
-    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+  isGramMatrixFieldKnown = false;
+  isCyclicProductsComputed = false;
+  cyclicProducts.clear();
+  computeCyclicProducts();
 
-    cout
-        << "Cyclo[s_, x_] := Product[Cyclotomic[s[[i]], x], {i, 1, Length[s]}];"
-        << endl;
-    if (debug)
-      cout << "Symb[s_, x_] := Product[Sum[x^i, {i, 0, s[[i]] - 1}], {i, 1, "
-              "Length[s]}];"
-           << endl;
+  isGrowthSeriesComputed = false;
+  isArithmetic = -1;
+  isCocompact = -2;
+  isFiniteCovolume = -2;
 
-    cout << "f[x_] := Cyclo[{";
-    for (unsigned int i(0); i < cycloSize; i++)
-      cout << (i ? "," : "") << growthSeries_cyclotomicNumerator[i];
-    cout << "},x]";
+  // ---------------------------------------------------------------------------
+  // Connected subgraphs
+  GraphsList *graphsListOld_spherical(graphsList_spherical),
+      *graphsListOld_euclidean(graphsList_euclidean);
 
-    cout << "/(";
-    Polynomials::polynomialDisplay(growthSeries_polynomialDenominator);
-    cout << ");";
+  graphsList_spherical =
+      new GraphsList(verticesCount, &map_vertices_indexToLabel);
+  graphsList_euclidean =
+      new GraphsList(verticesCount, &map_vertices_indexToLabel);
+  isGraphExplored = false;
 
-    if (debug)
-      cout << "\ng[x_] := (" << growthSeries_raw << ")^-1;";
-  } else if (ouputMathematicalFormat == "pari") {
-    unsigned int cycloSize(growthSeries_cyclotomicNumerator.size());
+  if (!isGraphsProductsComputed) {
+    delete graphsListOld_spherical;
+    delete graphsListOld_euclidean;
 
-    cout << "Cyclo = (S, y) -> prod(i=1, length(S), polcyclo(S[i],y));" << endl;
-    if (debug)
-      cout << "Symb = (S, y) -> prod(i=1, length(S), sum(i=0,S[i]-1,y^i));"
-           << endl;
+    return true;
+  }
 
-    cout << "f(x) = Cyclo([";
-    for (unsigned int i(0); i < cycloSize; i++)
-      cout << (i ? "," : "") << growthSeries_cyclotomicNumerator[i];
-    cout << "],x)/(";
-    Polynomials::polynomialDisplay(growthSeries_polynomialDenominator);
-    cout << ");";
+  const vector<Graph *> graphsByIdOld(graphsById); // Graphs of the products
+  exploreGraph();
 
-    if (debug)
-      cout << "\ng(x) = (" << growthSeries_raw << ")^-1;";
+  // ---------------------------------------------------------------------------
+  // Products of graphs
+  bool isEnumerationNeeded(
+      (isDimensionGuessed || useSymmetries || memoryBounded || streamedCheck) &&
+      (checkCocompactness || checkCofiniteness)); // Lists graphsProducts
+  for (unsigned int i(maximalSubgraphRank + 1); i < verticesCount; i++) {
+    if (!graphsProductsCount_spherical[i].empty() ||
+        !graphsProductsCount_euclidean[i].empty())
+      isEnumerationNeeded = true; // Not all enumerated
   }
-}
-
-ostream &operator<<(ostream &o, const CoxIter &g) {
-  o << "Graphes sphériques: " << endl;
-  o << *g.graphsList_spherical;
 
-  o << "Graphes euclidien: " << endl;
-  o << *g.graphsList_euclidean;
+  if (isEnumerationNeeded) {
+    delete graphsListOld_spherical;
+    delete graphsListOld_euclidean;
 
-  return o;
-}
+    for (auto &counts : graphsProductsCount_spherical)
+      counts.clear();
+    for (auto &counts : graphsProductsCount_euclidean)
+      counts.clear();
 
-int CoxIter::isGraphCocompact() {
-  if (isCocompact >= 0)
-    return isCocompact;
+    sphericalMaxRankFound = euclideanMaxRankFound = 0;
+    if (isDimensionGuessed) {
+      dimension = 0;
+      isDimensionGuessed = false;
+    }
 
-  if (!isGraphsProductsComputed)
+    isGraphsProductsComputed = false;
     computeGraphsProducts();
 
-  if (!checkCocompactness || !graphsProducts.size()) {
-    isCocompact = -1;
-    return -1;
+    return true;
   }
 
-  if (!graphsProducts[1].size() ||
-      !graphsProducts[0].size()) // No vertices, no edges
-  {
-    isCocompact = 0;
-    return 0;
+  // The previous connected graphs are the ones which do not contain the new
+  // vertex (in the same order)
+  unordered_map<Graph *, Graph *> graphsNew;
+  vector<vector<Graph *>> addedGraphs(2);
+  vector<unordered_map<Graph *, unsigned int>> graphsOrbits(2);
+
+  for (unsigned int k(0); k < 2; k++) {
+    GraphsList *graphsList(k ? graphsList_euclidean : graphsList_spherical);
+    GraphsListIterator grItOld(k ? graphsListOld_euclidean
+                                 : graphsListOld_spherical);
+
+    for (GraphsListIterator grIt(graphsList); grIt.ptr; ++grIt) {
+      if (find(grIt.ptr->vertices.begin(), grIt.ptr->vertices.end(),
+               newVertex) == grIt.ptr->vertices.end()) {
+        graphsNew[grItOld.ptr] = grIt.ptr;
+        ++grItOld;
+      } else {
+        graphsOrbits[k][grIt.ptr] = addedGraphs[k].size();
+        addedGraphs[k].push_back(grIt.ptr);
+      }
+    }
+
+    for (GraphsListIterator grIt(graphsList); grIt.ptr; ++grIt) {
+      if (graphsOrbits[k].find(grIt.ptr) == graphsOrbits[k].end())
+        graphsOrbits[k][grIt.ptr] = addedGraphs[k].size();
+    }
   }
 
-  if (hasBoldLine) {
-    isCocompact = 0;
-    return 0;
+  for (unsigned int k(0); k < 3; k++) {
+    vector<GraphsProductSet> products;
+
+    for (const auto &product : graphsProducts[k]) {
+      vector<unsigned int> ids;
+
+      for (const auto &id : product) {
+        // see checkCovolumeFiniteness
+        if (k == 2 && graphsByIdOld[id]->isSpherical)
+          break;
+
+        ids.push_back(graphsNew.at(graphsByIdOld[id])->id);
+      }
+
+      if (ids.size() == product.size())
+        products.push_back(GraphsProductSet(product.rank, ids));
+    }
+
+    graphsProducts[k] = products;
   }
 
-  // ----------------------------------------------------
-  // the test
-  if (useOpenMP && verticesCount >= 15)
-    isCocompact = isGraph_cocompact_finiteVolume_parallel(1) ? 1 : 0;
-  else
-    isCocompact = isGraph_cocompact_finiteVolume_sequential(1) ? 1 : 0;
+  delete graphsListOld_spherical;
+  delete graphsListOld_euclidean;
 
-  return isCocompact;
-}
+  // New products: each connected graph which contains the new vertex starts
+  // the products in which it is the first one (see
+  // computeGraphsProducts_representatives)
+  for (unsigned int k(0); k < 2; k++) {
+    vector<map<vector<vector<short unsigned int>>, unsigned int>> addedCounts(
+        verticesCount + 1);
+    auto &counts(k ? graphsProductsCount_euclidean
+                   : graphsProductsCount_spherical);
 
-int CoxIter::checkCovolumeFiniteness() {
-  if (isFiniteCovolume >= 0)
-    return isFiniteCovolume;
+    computeGraphsProducts_representatives(
+        k ? graphsList_euclidean : graphsList_spherical, addedGraphs[k],
+        vector<unsigned int>(addedGraphs[k].size(), 1), graphsOrbits[k],
+        &addedCounts, !k);
 
-  if (!isGraphsProductsComputed)
-    computeGraphsProducts();
+    symmetries_divideCounts(addedCounts);
 
-  // ----------------------------------------------------
-  // some stupid tests
-  if (!graphsProducts.size()) {
-    isFiniteCovolume = -1;
-    return -1;
+    for (unsigned int rank(0); rank <= verticesCount; rank++) {
+      for (const auto &count : addedCounts[rank])
+        counts[rank][count.first] += count.second;
+    }
   }
 
-  if (!graphsProducts[2].size() && !graphsProducts[1].size()) // No vertices
-  {
-    isFiniteCovolume = 0;
-    return 0;
+  if (isDimensionGuessed)
+    dimension = max(euclideanMaxRankFound + 1, sphericalMaxRankFound);
+
+  return true;
+}
+
+bool CoxIter::sweepEdgesOrders(const vector<pair<string, string>> &edges,
+                               const vector<vector<unsigned int>> &orders,
+                               vector<vector<unsigned int>> &assignments,
+                               vector<CoxIter_Results> &results,
+                               const bool &computeGrowthSeries) {
+  assignments.clear();
+  results.clear();
+
+  if (edges.size() != orders.size()) {
+    error = "The number of lists of orders must be the number of edges";
+    return false;
   }
 
-  if (!graphsProducts[0].size()) // No edges
-  {
-    isFiniteCovolume = 0;
-    return 0;
+  // ---------------------------------------------------------------------------
+  // Variable edges
+  vector<pair<unsigned int, unsigned int>> edgesIndices;
+
+  for (size_t i(0); i < edges.size(); i++) {
+    auto it1(map_vertices_labelToIndex.find(edges[i].first)),
+        it2(map_vertices_labelToIndex.find(edges[i].second));
+
+    if (it1 == map_vertices_labelToIndex.end() ||
+        it2 == map_vertices_labelToIndex.end()) {
+      error = "The following vertex is unknown: " +
+              (it1 == map_vertices_labelToIndex.end() ? edges[i].first
+                                                      : edges[i].second);
+      return false;
+    }
+
+    if (it1->second == it2->second || orders[i].empty()) {
+      error = "Invalid variable edge: " + edges[i].first + " " +
+              edges[i].second;
+      return false;
+    }
+
+    edgesIndices.push_back(make_pair(min(it1->second, it2->second),
+                                     max(it1->second, it2->second)));
   }
 
-  /*
-   * The duplication of the data is not beautiful but it allows
-   * us to simplify the code of the function isGraph_cocompact_finiteVolume.
-   * Moreover, we want the program to be quick but memory is not really an
-   * issue.
-   *
-   * [2] Contains a combined list of finite and infinite vertices
-   */
-  graphsProducts[2].insert(graphsProducts[2].end(), graphsProducts[1].begin(),
-                           graphsProducts[1].end());
+  // The invariant part is the graph without a minimal vertex cover of the
+  // variable edges (which always leaves at least one vertex)
+  vector<int> verticesIndices(verticesCount, 0); // -1 if removed
+  for (const auto &edge : edgesIndices) {
+    if (verticesIndices[edge.first] >= 0 && verticesIndices[edge.second] >= 0)
+      verticesIndices[edge.first] = -1;
+  }
 
-  // ----------------------------------------------------
-  // the test
-  if (useOpenMP && verticesCount >= 15)
-    isFiniteCovolume = isGraph_cocompact_finiteVolume_parallel(2) ? 1 : 0;
-  else
-    isFiniteCovolume = isGraph_cocompact_finiteVolume_sequential(2) ? 1 : 0;
+  for (unsigned int i(0); i < verticesCount; i++) {
+    bool isNeeded(false);
+    for (const auto &edge : edgesIndices) {
+      if ((edge.first == i && verticesIndices[edge.second] >= 0) ||
+          (edge.second == i && verticesIndices[edge.first] >= 0))
+        isNeeded = true;
+    }
 
-  return isFiniteCovolume;
-}
+    if (!isNeeded)
+      verticesIndices[i] = 0;
+  }
 
-bool CoxIter::isGraph_cocompact_finiteVolume_sequential(unsigned int index) {
-  unsigned int extendedCount;
+  // Vertices of the graphs of the assignments: first the invariant part, then
+  // the removed vertices (in the order in which they are added again)
+  vector<unsigned int> vertices, verticesAdded;
+  unsigned int invariantVerticesCount(0);
+  for (unsigned int i(0); i < verticesCount; i++) {
+    if (verticesIndices[i] < 0)
+      verticesAdded.push_back(i);
+    else {
+      verticesIndices[i] = invariantVerticesCount++;
+      vertices.push_back(i);
+    }
+  }
+  vertices.insert(vertices.end(), verticesAdded.begin(), verticesAdded.end());
 
-  vector<Graph *> diffSubNotBig, diffBigNotSub;
-  vector<Graph *>::const_iterator itGBig;
+  if (!invariantVerticesCount) {
+    error = "No graph given";
+    return false;
+  }
 
-  bool isExtendable;
+  // ---------------------------------------------------------------------------
+  // Assignments
+  assignments.push_back(vector<unsigned int>());
+  for (const auto &edgeOrders : orders) {
+    vector<vector<unsigned int>> assignmentsNew;
+
+    for (const auto &assignment : assignments) {
+      for (const auto &order : edgeOrders) {
+        assignmentsNew.push_back(assignment);
+        assignmentsNew.back().push_back(order);
+      }
+    }
 
-  for (const auto &sphericalProductsCodim1 : graphsProducts[0]) {
-    extendedCount = 0;
+    assignments = assignmentsNew;
+  }
 
-    for (const auto &gpBig : graphsProducts[index]) {
-      diffSubNotBig.clear();
-      diffBigNotSub.clear();
+  // ---------------------------------------------------------------------------
+  // Invariant part: explored once
+  const bool bWriteInfoBackup(bWriteInfo);
+  bWriteInfo = false;
 
-      set_difference(sphericalProductsCodim1.graphs.begin(),
-                     sphericalProductsCodim1.graphs.end(), gpBig.graphs.begin(),
-                     gpBig.graphs.end(), back_inserter(diffSubNotBig));
+  CoxIter invariant;
+  removeVertices_graph(verticesIndices, invariantVerticesCount, invariant);
+  invariant.computeGraphsProducts();
 
-      set_difference(gpBig.graphs.begin(), gpBig.graphs.end(),
-                     sphericalProductsCodim1.graphs.begin(),
-                     sphericalProductsCodim1.graphs.end(),
-                     back_inserter(diffBigNotSub));
+  bWriteInfo = bWriteInfoBackup;
 
-      isExtendable = true;
-      for (const auto &graphSub : diffSubNotBig) {
-        for (itGBig = diffBigNotSub.begin(); itGBig != diffBigNotSub.end();
-             ++itGBig) {
-          if (graphSub->isSubgraphOf(*itGBig))
-            break;
+  // ---------------------------------------------------------------------------
+  // Assignments
+  results = vector<CoxIter_Results>(assignments.size());
+
+#pragma omp parallel for if (useOpenMP) schedule(dynamic)
+  for (size_t i = 0; i < assignments.size(); i++) {
+    CoxIter ci;
+    invariant.removeVertices(vector<string>(), ci); // Copy
+
+    for (size_t j(0); j < verticesAdded.size(); j++) {
+      vector<unsigned int> vertexOrders;
+
+      for (unsigned int k(0); k < invariantVerticesCount + j; k++) {
+        const pair<unsigned int, unsigned int> edge(
+            min(verticesAdded[j], vertices[k]),
+            max(verticesAdded[j], vertices[k]));
+        unsigned int order(coxeterMatrix[verticesAdded[j]][vertices[k]]);
+
+        for (size_t e(0); e < edgesIndices.size(); e++) {
+          if (edgesIndices[e] == edge)
+            order = assignments[i][e];
         }
 
-        if (itGBig == diffBigNotSub.end()) {
-          isExtendable = false;
-          break;
-        }
+        vertexOrders.push_back(order);
       }
 
-      if (isExtendable)
-        extendedCount++;
+      ci.addVertex(vertexOrders, map_vertices_indexToLabel[verticesAdded[j]]);
     }
 
-    if (extendedCount != 2) {
-      if (debug) {
-        cout << "----------------------------------------------------------"
-             << endl;
-        cout << (index == 1 ? "Compactness" : "Finite covolume") << " test"
-             << endl;
-        cout << "Trying to extend the product: " << endl;
-        cout << sphericalProductsCodim1 << endl;
-        cout << "Succeeded in " << extendedCount << " ways instead of 2"
-             << endl;
+    if (checkCofiniteness)
+      ci.checkCovolumeFiniteness();
 
-        for (vector<GraphsProductSet>::const_iterator gpBig(
-                 graphsProducts[index].begin());
-             gpBig != graphsProducts[index].end(); ++gpBig) {
-          if (sphericalProductsCodim1.areVerticesSubsetOf(*gpBig))
-            cout << "Candidate: \n" << *gpBig << endl;
-        }
-        cout << "----------------------------------------------------------"
-             << endl;
-      }
+    const bool isEulerCharacteristicComputed(
+        ci.computeEulerCharacteristicFVector());
 
-      return 0;
-    }
+    if (checkCocompactness)
+      ci.isGraphCocompact();
+
+    if (computeGrowthSeries)
+      ci.growthSeries();
+
+    results[i] = ci.get_results();
+    results[i].isEulerCharacteristicComputed = isEulerCharacteristicComputed;
   }
 
-  return 1;
+  return true;
 }
 
-bool CoxIter::isGraph_cocompact_finiteVolume_parallel(unsigned int index) {
-  unsigned int extendedCount, max(graphsProducts[0].size()), i;
+void CoxIter::computeGraphsProducts(
+    GraphsListIterator grIt,
+    vector<map<vector<vector<short unsigned int>>, unsigned int>>
+        *graphsProductsCount,
+    const bool &isSpherical, GraphsProduct &gp,
+    vector<bool> &gpNonLinkableVertices) {
+  vector<short unsigned int>::iterator iIt;
+  vector<short unsigned int> flaggedVertices;
+  unsigned int graphRank(0);
 
-  vector<Graph *> diffSubNotBig, diffBigNotSub;
-  vector<Graph *>::const_iterator itGBig;
+  while (grIt.ptr && (gp.rank + graphRank <= maximalSubgraphRank)) {
+    // ---------------------------------------------------
+    // est ce que le graphe est admissible?
+    for (iIt = grIt.ptr->vertices.begin(); iIt != grIt.ptr->vertices.end();
+         ++iIt) {
+      if (gpNonLinkableVertices[*iIt]) // si pas linkable
+        break;
+    }
 
-  bool isExtendable, exit(false);
+    // si le graphe est admissible
+    if (iIt == grIt.ptr->vertices.end()) {
+      // le graphe est ajouté au produit
+      gp.graphs.push_back(grIt.ptr);
 
-#pragma omp parallel if (useOpenMP && verticesCount >= 15)
-  {
-#pragma omp single nowait
-    {
-      for (i = 0; i < max && !exit; i++) {
-#pragma omp task private(itGBig, isExtendable, diffSubNotBig, diffBigNotSub,   \
-                         extendedCount) shared(max, index, exit)               \
-    firstprivate(i)
-        {
-          extendedCount = 0;
+      // taille du graphe courant
+      graphRank = isSpherical ? grIt.ptr->vertices.size()
+                              : (grIt.ptr->vertices.size() - 1);
+      gp.rank += graphRank;
 
-          for (const auto &gpBig : graphsProducts[index]) {
-            diffSubNotBig.clear();
-            diffBigNotSub.clear();
-            set_difference(graphsProducts[0][i].graphs.begin(),
-                           graphsProducts[0][i].graphs.end(),
-                           gpBig.graphs.begin(), gpBig.graphs.end(),
-                           back_inserter(diffSubNotBig));
-
-            set_difference(gpBig.graphs.begin(), gpBig.graphs.end(),
-                           graphsProducts[0][i].graphs.begin(),
-                           graphsProducts[0][i].graphs.end(),
-                           back_inserter(diffBigNotSub));
+      computeGraphsProducts_addProduct(gp, graphsProductsCount, isSpherical, 1,
+                                       0);
 
-            isExtendable = true;
-            for (const auto &graphSub : diffSubNotBig) {
-              for (itGBig = diffBigNotSub.begin();
-                   itGBig != diffBigNotSub.end(); ++itGBig) {
-                if (graphSub->isSubgraphOf(*itGBig))
-                  break;
-              }
+      // mise à jour des sommets que l'on ne peut plus prendre
+      for (unsigned int i = 0; i < verticesCount; i++) {
+        if (!grIt.ptr->linkableVertices[i] && !gpNonLinkableVertices[i]) {
+          flaggedVertices.push_back(i);
+          gpNonLinkableVertices[i] = true;
+        }
+      }
 
-              if (itGBig == diffBigNotSub.end()) {
-                isExtendable = false;
-                break;
-              }
-            }
+      // récursion
+      computeGraphsProducts(++grIt, graphsProductsCount, isSpherical, gp,
+                            gpNonLinkableVertices);
 
-            if (isExtendable)
-              extendedCount++;
-          }
+      // -----------------------------------------------
+      // dé-initialisations
 
-          if (extendedCount != 2) {
-            if (debug) {
-#pragma omp critical
-              {
-                cout << "------------------------------------------------------"
-                        "----"
-                     << endl;
-                cout << (index == 1 ? "Compactness" : "Finite covolume")
-                     << " test" << endl;
-                cout << "Trying to extend the product: " << endl;
-                cout << graphsProducts[0][i] << endl;
-                cout << "Succeeded in " << extendedCount << " ways instead of 2"
-                     << endl;
+      // on remet la liste à son état d'avant la récursion
+      for (iIt = flaggedVertices.begin(); iIt != flaggedVertices.end(); ++iIt)
+        gpNonLinkableVertices[*iIt] = false;
 
-                for (const auto &gpBig : graphsProducts[index]) {
-                  if (graphsProducts[0][i].areVerticesSubsetOf(gpBig))
-                    cout << "Candidate: \n" << gpBig << endl;
-                }
-                cout << "------------------------------------------------------"
-                        "----"
-                     << endl;
-              }
-            }
+      gp.rank -= graphRank;
 
-#pragma omp atomic write
-            exit = true;
-          }
+      // le graphe est enlevé
+      gp.graphs.pop_back();
+
+      if (!gp.graphs.size())
+        break;
+    } else
+      ++grIt;
+  }
+}
+
+void CoxIter::computeGraphsProducts_addProduct(
+    GraphsProduct &gp,
+    vector<map<vector<vector<short unsigned int>>, unsigned int>>
+        *graphsProductsCount,
+    const bool &isSpherical, const unsigned int &weight,
+    const unsigned int &orbitGraphsCount) {
+  // Create the footprint of the product. The goal is to decide if we
+  // already have this product
+  vector<vector<short unsigned int>> vFootPrintTest(gp.createFootPrint());
+  if (orbitGraphsCount) // see symmetries_divideCounts
+    vFootPrintTest.push_back(vector<short unsigned int>(1, orbitGraphsCount));
+
+  auto addProduct = [&]() {
+    stats.productsCount++;
+
+    if (isInfSeqInGraphsProducts) // see IS_computations
+      IS_addProduct(gp, isSpherical);
+
+    if (checkCocompactness || checkCofiniteness) {
+      if (isCheckStreamed)
+        graphsProducts_stream(gp, isSpherical);
+      else if (dimension) // If we know the dimension, everything is easier
+      {
+        if (isSpherical) {
+          // Keeping track of spherical subgraphs
+          if ((gp.rank == (dimension - 1) || gp.rank == dimension))
+            graphsProducts_add(gp.rank + 1 - dimension, gp);
         }
 
-        if (exit)
-          break;
+        // Euclidean subgraphs
+        if (!isSpherical && gp.rank == (dimension - 1) && checkCofiniteness)
+          graphsProducts_add(2, gp);
+      } else {
+        if (isSpherical) {
+          if (gp.rank == sphericalMaxRankFound + 1) {
+            graphsProducts_shift();
+            graphsProducts_add(1, gp);
+          } else if (gp.rank > sphericalMaxRankFound + 1) {
+            graphsProducts_clear(0);
+            graphsProducts_clear(1);
+            graphsProducts_add(1, gp);
+          } else if (gp.rank + 1 >= sphericalMaxRankFound)
+            graphsProducts_add(gp.rank + 1 - sphericalMaxRankFound, gp);
+        } else {
+          if (checkCofiniteness) {
+            if (gp.rank > euclideanMaxRankFound)
+              graphsProducts_clear(2);
+
+            if (gp.rank >= euclideanMaxRankFound)
+              graphsProducts_add(2, gp);
+          }
+        }
       }
     }
-  }
 
-  return !exit;
-}
+    if (isSpherical && gp.rank >= sphericalMaxRankFound)
+      sphericalMaxRankFound = gp.rank;
 
-void CoxIter::computeGraphsProducts() {
-  if (isGraphsProductsComputed)
-    return;
+    if (!isSpherical && gp.rank >= euclideanMaxRankFound)
+      euclideanMaxRankFound = gp.rank;
 
-  if (!isGraphExplored)
-    exploreGraph();
+    if ((*graphsProductsCount)[gp.rank].find(vFootPrintTest) ==
+        (*graphsProductsCount)[gp.rank].end()) {
+      (*graphsProductsCount)[gp.rank][vFootPrintTest] = weight;
+      stats.footprintsCount++;
+    } else
+      (*graphsProductsCount)[gp.rank][vFootPrintTest] += weight;
+  };
 
-  if (debug) {
-    cout << "Connected spherical graphs" << endl;
-    cout << *this->graphsList_spherical << endl;
+  // The lock is global: it is not taken if the products are not enumerated in
+  // parallel (e.g. several graphs analysed in parallel, see sweepEdgesOrders)
+  if (omp_get_num_threads() > 1) {
+#pragma omp critical
+    addProduct();
+  } else
+    addProduct();
+}
+
+void CoxIter::computeGraphsIds() {
+  graphsById.clear();
+
+  for (unsigned int k(0); k < 2; k++) {
+    for (GraphsListIterator grIt(k ? graphsList_euclidean
+                                   : graphsList_spherical);
+         grIt.ptr; ++grIt)
+      graphsById.push_back(grIt.ptr);
   }
 
-  graphsProducts = vector<vector<GraphsProductSet>>(3);
-  vector<bool> gpNonLinkableVertices(vector<bool>(verticesCount, false));
-  GraphsProduct gp; ///< Current graphs product
+  sort(graphsById.begin(), graphsById.end(), GraphPtrComp());
 
-  // --------------------------------------------------------------
-  // produits de graphes sphériques
-  GraphsListIterator grIt_spherical(this->graphsList_spherical);
+  for (unsigned int i(0); i < graphsById.size(); i++)
+    graphsById[i]->id = i;
+}
 
-#pragma omp parallel if (useOpenMP && verticesCount >= 15)
-  {
-#pragma omp single nowait
-    while (grIt_spherical.ptr) {
-#pragma omp task firstprivate(grIt_spherical, gpNonLinkableVertices, gp)
-      {
-        computeGraphsProducts(grIt_spherical, &graphsProductsCount_spherical,
-                              true, gp, gpNonLinkableVertices);
-      }
+void CoxIter::graphsProducts_add(const unsigned int &k,
+                                 const GraphsProduct &gp) {
+  if (isGraphsProductsIds)
+    graphsProductsIds[k].push_back(gp);
+  else
+    graphsProducts[k].push_back(GraphsProductSet(gp));
+}
 
-      ++grIt_spherical;
-    }
-  }
+void CoxIter::graphsProducts_clear(const unsigned int &k) {
+  graphsProducts[k].clear();
+  graphsProductsIds[k].clear();
+}
 
-  // --------------------------------------------------------------
-  // produits de graphes euclidiens
-  if (debug) {
-    cout << "Connected euclidean graphs" << endl;
-    cout << *this->graphsList_euclidean;
-  }
+void CoxIter::graphsProducts_shift() {
+  graphsProducts[0] = graphsProducts[1];
+  graphsProducts[1].clear();
 
-  GraphsListIterator grIt_euclidean(this->graphsList_euclidean);
-#pragma omp parallel if (useOpenMP && verticesCount >= 15)
-  {
-#pragma omp single nowait
-    while (grIt_euclidean.ptr) {
-#pragma omp task firstprivate(grIt_euclidean, gpNonLinkableVertices, gp)
-      {
-        computeGraphsProducts(grIt_euclidean, &graphsProductsCount_euclidean,
-                              false, gp, gpNonLinkableVertices);
-      }
+  graphsProductsIds[0] = graphsProductsIds[1];
+  graphsProductsIds[1].clear();
+}
 
-      ++grIt_euclidean;
+size_t CoxIter::graphsProducts_size(const unsigned int &k) const {
+  if (isCheckStreamed)
+    return k ? graphsProductsStreamedCount[k] : graphsProductsExtensions.size();
+
+  return isGraphsProductsIds ? graphsProductsIds[k].size()
+                             : graphsProducts[k].size();
+}
+
+void CoxIter::graphsProducts_stream(const GraphsProduct &gp,
+                                    const bool &isSpherical) {
+  vector<short unsigned int> vertices, verticesSub;
+  for (const auto &graph : gp.graphs)
+    vertices.insert(vertices.end(), graph->vertices.begin(),
+                    graph->vertices.end());
+
+  if (isSpherical) {
+    if (gp.rank + 1 == dimension) {
+      sort(vertices.begin(), vertices.end());
+      graphsProductsExtensions[vertices]; // The product may not be extended
+    } else if (gp.rank == dimension) {
+      graphsProductsStreamedCount[1]++;
+
+      sort(vertices.begin(), vertices.end());
+      for (unsigned int i(0); i < vertices.size(); i++) {
+        verticesSub = vertices;
+        verticesSub.erase(verticesSub.begin() + i);
+        graphsProductsExtensions[verticesSub].first++;
+      }
     }
-  }
 
-  if (debug) {
-    cout << "\nProduct of euclidean graphs" << endl;
-    printEuclideanGraphsProducts(&graphsProductsCount_euclidean);
+    return;
   }
 
-  isGraphsProductsComputed = true;
+  if (gp.rank + 1 != dimension || !checkCofiniteness)
+    return;
 
-  // ---------------------------------------------------------
-  // We guess the dimension
-  if (!dimension) {
-    dimension = max(euclideanMaxRankFound + 1, sphericalMaxRankFound);
-    isDimensionGuessed = true;
+  graphsProductsStreamedCount[2]++;
+
+  // One vertex is removed from each component (the graphs are connected
+  // euclidean graphs: the other subgraphs of rank n-1 are not spherical)
+  const size_t componentsCount(gp.graphs.size());
+  vector<unsigned int> removed(componentsCount, 0);
+
+  while (true) {
+    verticesSub.clear();
+    for (unsigned int c(0); c < componentsCount; c++) {
+      const vector<short unsigned int> &verticesComponent(
+          gp.graphs[c]->vertices);
+
+      for (unsigned int i(0); i < verticesComponent.size(); i++) {
+        if (i != removed[c])
+          verticesSub.push_back(verticesComponent[i]);
+      }
+    }
+
+    sort(verticesSub.begin(), verticesSub.end());
+    graphsProductsExtensions[verticesSub].second++;
+
+    // Next choice of the removed vertices
+    unsigned int c(0);
+    for (; c < componentsCount; c++) {
+      if (++removed[c] < gp.graphs[c]->vertices.size())
+        break;
 
-    if (euclideanMaxRankFound == sphericalMaxRankFound) {
-      graphsProducts[0] = graphsProducts[1];
-      graphsProducts[1].clear();
-    } else if (euclideanMaxRankFound > sphericalMaxRankFound) {
-      graphsProducts[0].clear();
-      graphsProducts[1].clear();
-    } else if (sphericalMaxRankFound > euclideanMaxRankFound + 1) {
-      graphsProducts[2].clear();
+      removed[c] = 0;
     }
+
+    if (c == componentsCount)
+      break;
   }
 }
 
-void CoxIter::computeGraphsProducts(
+void CoxIter::computeGraphsProducts_representatives(
+    GraphsList *graphsList, const vector<Graph *> &representatives,
+    const vector<unsigned int> &orbitsSizes,
+    const unordered_map<Graph *, unsigned int> &graphsOrbits,
+    vector<map<vector<vector<short unsigned int>>, unsigned int>>
+        *graphsProductsCount,
+    const bool &isSpherical) {
+#pragma omp parallel for if (useOpenMP && verticesCount >= 15) \
+    schedule(dynamic)
+  for (size_t i = 0; i < representatives.size(); i++) {
+    Graph *graph(representatives[i]);
+    GraphsProduct gp;
+    vector<bool> gpNonLinkableVertices(verticesCount, false);
+
+    gp.graphs.push_back(graph);
+    gp.rank = isSpherical ? graph->vertices.size()
+                          : (graph->vertices.size() - 1);
+
+    for (unsigned int j(0); j < verticesCount; j++)
+      gpNonLinkableVertices[j] = !graph->linkableVertices[j];
+
+    computeGraphsProducts_addProduct(gp, graphsProductsCount, isSpherical,
+                                     orbitsSizes[i], 1);
+
+    computeGraphsProducts_symmetries(
+        GraphsListIterator(graphsList), graphsProductsCount, isSpherical, gp,
+        gpNonLinkableVertices, graphsOrbits, i, orbitsSizes[i], 1);
+  }
+}
+
+void CoxIter::computeGraphsProducts_symmetries(
     GraphsListIterator grIt,
     vector<map<vector<vector<short unsigned int>>, unsigned int>>
         *graphsProductsCount,
     const bool &isSpherical, GraphsProduct &gp,
-    vector<bool> &gpNonLinkableVertices) {
+    vector<bool> &gpNonLinkableVertices,
+    const unordered_map<Graph *, unsigned int> &graphsOrbits,
+    const unsigned int &orbit, const unsigned int &orbitSize,
+    const unsigned int &orbitGraphsCount) {
   vector<short unsigned int>::iterator iIt;
   vector<short unsigned int> flaggedVertices;
-  unsigned int graphRank(0);
-  vector<vector<short unsigned int>> vFootPrintTest;
+  unsigned int graphRank(0), graphOrbit;
 
   while (grIt.ptr && (gp.rank + graphRank <= maximalSubgraphRank)) {
     // ---------------------------------------------------
@@ -1602,8 +3686,12 @@ void CoxIter::computeGraphsProducts(
         break;
     }
 
+    // the graphs of the previous orbits are not taken
+    if (iIt == grIt.ptr->vertices.end())
+      graphOrbit = graphsOrbits.at(grIt.ptr);
+
     // si le graphe est admissible
-    if (iIt == grIt.ptr->vertices.end()) {
+    if (iIt == grIt.ptr->vertices.end() && graphOrbit >= orbit) {
       // le graphe est ajouté au produit
       gp.graphs.push_back(grIt.ptr);
 
@@ -1612,62 +3700,10 @@ void CoxIter::computeGraphsProducts(
                               : (grIt.ptr->vertices.size() - 1);
       gp.rank += graphRank;
 
-      // Create the footprint of the product. The goal is to decide if we
-      // already have this product
-      vFootPrintTest = gp.createFootPrint();
-
-#pragma omp critical
-      {
-        if (checkCocompactness || checkCofiniteness) {
-          if (dimension) // If we know the dimension, everything is easier
-          {
-            if (isSpherical) {
-              // Keeping track of spherical subgraphs
-              if ((gp.rank == (dimension - 1) || gp.rank == dimension))
-                graphsProducts[gp.rank + 1 - dimension].push_back(
-                    GraphsProductSet(gp));
-            }
-
-            // Euclidean subgraphs
-            if (!isSpherical && gp.rank == (dimension - 1) && checkCofiniteness)
-              graphsProducts[2].push_back(GraphsProductSet(gp));
-          } else {
-            if (isSpherical) {
-              if (gp.rank == sphericalMaxRankFound + 1) {
-                graphsProducts[0] = graphsProducts[1];
-                graphsProducts[1].clear();
-                graphsProducts[1].push_back(GraphsProductSet(gp));
-              } else if (gp.rank > sphericalMaxRankFound + 1) {
-                graphsProducts[0].clear();
-                graphsProducts[1].clear();
-                graphsProducts[1].push_back(GraphsProductSet(gp));
-              } else if (gp.rank + 1 >= sphericalMaxRankFound)
-                graphsProducts[gp.rank + 1 - sphericalMaxRankFound].push_back(
-                    GraphsProductSet(gp));
-            } else {
-              if (checkCofiniteness) {
-                if (gp.rank > euclideanMaxRankFound)
-                  graphsProducts[2].clear();
-
-                if (gp.rank >= euclideanMaxRankFound)
-                  graphsProducts[2].push_back(GraphsProductSet(gp));
-              }
-            }
-          }
-        }
-
-        if (isSpherical && gp.rank >= sphericalMaxRankFound)
-          sphericalMaxRankFound = gp.rank;
-
-        if (!isSpherical && gp.rank >= euclideanMaxRankFound)
-          euclideanMaxRankFound = gp.rank;
-
-        if ((*graphsProductsCount)[gp.rank].find(vFootPrintTest) ==
-            (*graphsProductsCount)[gp.rank].end())
-          (*graphsProductsCount)[gp.rank][vFootPrintTest] = 1;
-        else
-          (*graphsProductsCount)[gp.rank][vFootPrintTest]++;
-      }
+      const unsigned int orbitGraphsCountNew(
+          orbitGraphsCount + (graphOrbit == orbit ? 1 : 0));
+      computeGraphsProducts_addProduct(gp, graphsProductsCount, isSpherical,
+                                       orbitSize, orbitGraphsCountNew);
 
       // mise à jour des sommets que l'on ne peut plus prendre
       for (unsigned int i = 0; i < verticesCount; i++) {
@@ -1678,29 +3714,181 @@ void CoxIter::computeGraphsProducts(
       }
 
       // récursion
-      computeGraphsProducts(++grIt, graphsProductsCount, isSpherical, gp,
-                            gpNonLinkableVertices);
+      computeGraphsProducts_symmetries(
+          ++grIt, graphsProductsCount, isSpherical, gp, gpNonLinkableVertices,
+          graphsOrbits, orbit, orbitSize, orbitGraphsCountNew);
 
       // -----------------------------------------------
       // dé-initialisations
-
-      // on remet la liste à son état d'avant la récursion
       for (iIt = flaggedVertices.begin(); iIt != flaggedVertices.end(); ++iIt)
         gpNonLinkableVertices[*iIt] = false;
 
       gp.rank -= graphRank;
-
-      // le graphe est enlevé
       gp.graphs.pop_back();
-
-      if (!gp.graphs.size())
-        break;
     } else
       ++grIt;
   }
 }
 
-void CoxIter::IS_computations(const string &t0, const string &s0) {
+bool CoxIter::symmetries_graphsOrbits(
+    GraphsList *graphsList, const vector<vector<unsigned int>> &automorphisms,
+    vector<Graph *> &representatives, vector<unsigned int> &orbitsSizes,
+    unordered_map<Graph *, unsigned int> &graphsOrbits,
+    map<vector<short unsigned int>, Graph *> &graphsByVertices) const {
+  vector<Graph *> graphs;
+  map<vector<short unsigned int>, size_t> indices;
+
+  for (GraphsListIterator grIt(graphsList); grIt.ptr; ++grIt) {
+    vector<short unsigned int> vertices(grIt.ptr->vertices);
+    sort(vertices.begin(), vertices.end());
+
+    if (!indices.insert(make_pair(vertices, graphs.size())).second)
+      return false;
+
+    graphsByVertices[vertices] = grIt.ptr;
+    graphs.push_back(grIt.ptr);
+  }
+
+  // Orbits (union-find)
+  vector<size_t> orbits(graphs.size());
+  for (size_t i(0); i < graphs.size(); i++)
+    orbits[i] = i;
+
+  auto orbit = [&orbits](size_t i) {
+    while (orbits[i] != i)
+      i = orbits[i] = orbits[orbits[i]];
+
+    return i;
+  };
+
+  for (size_t i(0); i < graphs.size(); i++) {
+    for (const auto &automorphism : automorphisms) {
+      vector<short unsigned int> image;
+      for (const auto &vertex : graphs[i]->vertices)
+        image.push_back(automorphism[vertex]);
+      sort(image.begin(), image.end());
+
+      auto itImage(indices.find(image));
+      if (itImage == indices.end())
+        return false;
+
+      orbits[orbit(itImage->second)] = orbit(i);
+    }
+  }
+
+  // The first graph of each orbit is the representative
+  vector<unsigned int> sizes(graphs.size(), 0);
+  vector<size_t> orbitsFirst;
+  for (size_t i(0); i < graphs.size(); i++) {
+    if (!sizes[orbit(i)]++)
+      orbitsFirst.push_back(i);
+  }
+
+  // The biggest orbits first: a product is enumerated from the first orbit
+  // of its components
+  stable_sort(orbitsFirst.begin(), orbitsFirst.end(),
+              [&](const size_t &a, const size_t &b) {
+                return sizes[orbit(a)] > sizes[orbit(b)];
+              });
+
+  vector<unsigned int> orbitsIndices(graphs.size());
+  representatives.clear();
+  orbitsSizes.clear();
+  for (const auto &first : orbitsFirst) {
+    orbitsIndices[orbit(first)] = representatives.size();
+    representatives.push_back(graphs[first]);
+    orbitsSizes.push_back(sizes[orbit(first)]);
+  }
+
+  for (size_t i(0); i < graphs.size(); i++)
+    graphsOrbits[graphs[i]] = orbitsIndices[orbit(i)];
+
+  return true;
+}
+
+void CoxIter::symmetries_productsOrbits(
+    vector<GraphsProductSet> &products,
+    const vector<vector<unsigned int>> &automorphisms,
+    const map<vector<short unsigned int>, Graph *> &graphsByVertices,
+    const bool &isClosure) const {
+  // A product is determined by its vertices
+  auto productVertices = [this](const GraphsProductSet &gp) {
+    vector<short unsigned int> vertices(gp.get_vertices(graphsById));
+    sort(vertices.begin(), vertices.end());
+    return vertices;
+  };
+
+  set<vector<short unsigned int>> productsSeen;
+  vector<GraphsProductSet> productsNew, productsToDo;
+
+  for (const auto &product : products) {
+    if (!productsSeen.insert(productVertices(product)).second)
+      continue;
+
+    productsNew.push_back(product);
+
+    // Orbit of the product
+    productsToDo.push_back(product);
+    while (!productsToDo.empty()) {
+      const GraphsProductSet current(productsToDo.back());
+      productsToDo.pop_back();
+
+      for (const auto &automorphism : automorphisms) {
+        vector<unsigned int> ids;
+
+        for (const auto &id : current) {
+          vector<short unsigned int> vertices;
+          for (const auto &vertex : graphsById[id]->vertices)
+            vertices.push_back(automorphism[vertex]);
+          sort(vertices.begin(), vertices.end());
+
+          ids.push_back(graphsByVertices.at(vertices)->id);
+        }
+
+        const GraphsProductSet image(current.rank, ids);
+
+        if (!productsSeen.insert(productVertices(image)).second)
+          continue;
+
+        if (isClosure)
+          productsNew.push_back(image);
+        productsToDo.push_back(image);
+      }
+    }
+  }
+
+  products = productsNew;
+}
+
+void CoxIter::symmetries_divideCounts(
+    vector<map<vector<vector<short unsigned int>>, unsigned int>>
+        &graphsProductsCount) {
+  for (auto &counts : graphsProductsCount) {
+    map<vector<vector<short unsigned int>>, unsigned int> countsNew;
+
+    for (const auto &count : counts) {
+      // Last element of the key: number of components in the first orbit
+      vector<vector<short unsigned int>> footprint(count.first);
+      const unsigned int orbitGraphsCount(footprint.back()[0]);
+      footprint.pop_back();
+
+      countsNew[footprint] += count.second / orbitGraphsCount;
+    }
+
+    // The products of rank bigger than maximalSubgraphRank are not all
+    // enumerated (even without the symmetries): only their existence matters
+    for (auto &count : countsNew)
+      count.second = max(count.second, 1u);
+
+    counts = countsNew;
+  }
+}
+
+void CoxIter::IS_computations(const string &t0, const string &s0,
+                              const bool &withGraphsProducts) {
+  if (!dimension)
+    throw(string("CoxIter::IS_computations: Dimension not specified"));
+
   infSeq_t0 = get_vertexIndex(t0);
   infSeq_s0 = get_vertexIndex(s0);
 
@@ -1713,9 +3901,21 @@ void CoxIter::IS_computations(const string &t0, const string &s0) {
   if (!isGraphExplored)
     exploreGraph();
 
-  if (!isGraphsProductsComputed)
+  // One enumeration for both
+  if (withGraphsProducts && !isGraphsProductsComputed) {
+    const bool useSymmetries_(useSymmetries);
+
+    useSymmetries = false;
+    isInfSeqInGraphsProducts = true;
+
     computeGraphsProducts();
 
+    isInfSeqInGraphsProducts = false;
+    useSymmetries = useSymmetries_;
+
+    return;
+  }
+
   vector<bool> gpNonLinkableVertices(vector<bool>(verticesCount, false));
   GraphsProduct gp; ///< Current graphs product
 
@@ -1755,6 +3955,53 @@ void CoxIter::IS_computations(const string &t0, const string &s0) {
   }
 }
 
+void CoxIter::IS_addProduct(const GraphsProduct &gp, const bool &isSpherical) {
+  if (!isSpherical && gp.rank != (dimension - 1))
+    return;
+
+  bool bSpecialIn_t0(false), bSpecialIn_s0(false);
+  unsigned int nonCommute_t0(0), nonCommute_s0(0);
+
+  for (const auto &g : gp.graphs) {
+    for (const auto &v : g->vertices) {
+      if (v == infSeq_t0)
+        bSpecialIn_t0 = true;
+      else if (coxeterMatrix[v][infSeq_t0] != 2)
+        nonCommute_t0++;
+
+      if (v == infSeq_s0)
+        bSpecialIn_s0 = true;
+      else if (coxeterMatrix[v][infSeq_s0] != 2)
+        nonCommute_s0++;
+    }
+  }
+
+  const unsigned int index(isSpherical ? dimension - gp.rank : 0);
+
+  if (!bSpecialIn_t0 && !bSpecialIn_s0) {
+    if (!nonCommute_t0 && !nonCommute_s0)
+      infSeqFVectorsUnits[index]++;
+    else if (nonCommute_t0 && nonCommute_s0)
+      infSeqFVectorsPowers[index] += 2;
+    else if (nonCommute_t0 && !nonCommute_s0) {
+      infSeqFVectorsUnits[index]++;
+      infSeqFVectorsPowers[index]++;
+    } else
+      infSeqFVectorsPowers[index]++;
+  } else if (!bSpecialIn_t0 && bSpecialIn_s0) {
+    if (!nonCommute_s0)
+      infSeqFVectorsUnits[index] += 2;
+    else {
+      infSeqFVectorsUnits[index]++;
+      infSeqFVectorsPowers[index]++;
+    }
+  } else if (bSpecialIn_t0 && !bSpecialIn_s0) {
+    if (nonCommute_t0)
+      infSeqFVectorsPowers[index]++;
+  } else
+    infSeqFVectorsUnits[index]++;
+}
+
 void CoxIter::computeGraphsProducts_IS(GraphsListIterator grIt,
                                        const bool &isSpherical,
                                        GraphsProduct &gp,
@@ -1783,49 +4030,7 @@ void CoxIter::computeGraphsProducts_IS(GraphsListIterator grIt,
       gp.rank += graphRank;
 
 #pragma omp critical
-      {
-        if (isSpherical || gp.rank == (dimension - 1)) {
-          bool bSpecialIn_t0(false), bSpecialIn_s0(false);
-          unsigned int nonCommute_t0(0), nonCommute_s0(0);
-
-          for (const auto &g : gp.graphs) {
-            for (const auto &v : g->vertices) {
-              if (v == infSeq_t0)
-                bSpecialIn_t0 = true;
-              else if (coxeterMatrix[v][infSeq_t0] != 2)
-                nonCommute_t0++;
-
-              if (v == infSeq_s0)
-                bSpecialIn_s0 = true;
-              else if (coxeterMatrix[v][infSeq_s0] != 2)
-                nonCommute_s0++;
-            }
-          }
-
-          if (!bSpecialIn_t0 && !bSpecialIn_s0) {
-            if (!nonCommute_t0 && !nonCommute_s0)
-              infSeqFVectorsUnits[isSpherical ? dimension - gp.rank : 0]++;
-            else if (nonCommute_t0 && nonCommute_s0)
-              infSeqFVectorsPowers[isSpherical ? dimension - gp.rank : 0] += 2;
-            else if (nonCommute_t0 && !nonCommute_s0) {
-              infSeqFVectorsUnits[isSpherical ? dimension - gp.rank : 0]++;
-              infSeqFVectorsPowers[isSpherical ? dimension - gp.rank : 0]++;
-            } else
-              infSeqFVectorsPowers[isSpherical ? dimension - gp.rank : 0]++;
-          } else if (!bSpecialIn_t0 && bSpecialIn_s0) {
-            if (!nonCommute_s0)
-              infSeqFVectorsUnits[isSpherical ? dimension - gp.rank : 0] += 2;
-            else {
-              infSeqFVectorsUnits[isSpherical ? dimension - gp.rank : 0]++;
-              infSeqFVectorsPowers[isSpherical ? dimension - gp.rank : 0]++;
-            }
-          } else if (bSpecialIn_t0 && !bSpecialIn_s0) {
-            if (nonCommute_t0)
-              infSeqFVectorsPowers[isSpherical ? dimension - gp.rank : 0]++;
-          } else
-            infSeqFVectorsUnits[isSpherical ? dimension - gp.rank : 0]++;
-        }
-      }
+      IS_addProduct(gp, isSpherical);
 
       // mise à jour des sommets que l'on ne peut plus prendre
       for (unsigned int i = 0; i < verticesCount; i++) {
@@ -1858,6 +4063,8 @@ void CoxIter::computeGraphsProducts_IS(GraphsListIterator grIt,
 }
 
 bool CoxIter::canBeFiniteCovolume() {
+  StageTimer timer(stats.canBeFiniteCovolumeTime);
+
   // -----------------------------------------------------------
   // Some verifications
   if (!dimension)
@@ -1903,9 +4110,9 @@ bool CoxIter::canBeFiniteCovolume() {
          graphsProducts_canBeFiniteCovolume[0]) // TODO OPTIMIZATION
                                                 // paralleliser?
     {
-      for (auto gr : graphProd.graphs) {
+      for (const auto &id : graphProd) {
         // For two affine graphs G1 and G2, G1 is a subgraph of G2 iff G1=G2
-        if (*grIt_euclidean.ptr == *gr) {
+        if (*grIt_euclidean.ptr == *graphsById[id]) {
           canBeExtended = true;
           break;
         }
@@ -1917,9 +4124,9 @@ bool CoxIter::canBeFiniteCovolume() {
 
     if (!canBeExtended) {
       if (debug) {
-        cout << "Can be of finite covolume: no" << endl;
-        cout << "\tCannot extend the affine graph: " << endl;
-        cout << "\t" << *grIt_euclidean.ptr << "\n" << endl;
+        *out << "Can be of finite covolume: no" << endl;
+        *out << "\tCannot extend the affine graph: " << endl;
+        *out << "\t" << *grIt_euclidean.ptr << "\n" << endl;
       }
 
       return false;
@@ -2044,14 +4251,14 @@ vector<vector<short unsigned int>> CoxIter::canBeFiniteCovolume_complete() {
 
       for (auto gpBig : graphsProducts_canBeFiniteCovolume[dimension - 1]) {
         // First test
-        if (!gpSmall.areVerticesSubsetOf(gpBig))
+        if (!gpSmall.areVerticesSubsetOf(gpBig, graphsById))
           continue;
 
         isSubproduct = true;
-        for (auto gSmall : gpSmall.graphs) {
+        for (auto gSmall : gpSmall) {
           found = false;
-          for (auto gBig : gpBig.graphs) {
-            if (*gSmall == *gBig) {
+          for (auto gBig : gpBig) {
+            if (*graphsById[gSmall] == *graphsById[gBig]) {
               found = true;
               break;
             }
@@ -2070,7 +4277,7 @@ vector<vector<short unsigned int>> CoxIter::canBeFiniteCovolume_complete() {
       }
 
       if (!canBeExtended) {
-        graphsNotExtendable.push_back(gpSmall.get_vertices());
+        graphsNotExtendable.push_back(gpSmall.get_vertices(graphsById));
       }
     }
   }
@@ -2227,6 +4434,8 @@ void CoxIter::growthSeries_mergeTerms(vector<mpz_class> &polynomial,
 }
 
 void CoxIter::growthSeries() {
+  StageTimer timer(stats.growthSeriesTime);
+
   if (!useOpenMP || verticesCount < 10)
     growthSeries_sequential();
   else
@@ -2399,13 +4608,13 @@ void CoxIter::growthSeries_sequential() {
   // --------------------------------------------------------------
   // Simplifications
   unsigned int cyclotomicTempSize(cyclotomicTemp.size()),
-      cyclotomicMax(Polynomials::cyclotomicPolynomials.size() - 1);
+      cyclotomicMax(Polynomials::cyclotomicPolynomials().size() - 1);
 
   for (unsigned int i(0); i < cyclotomicTempSize; i++) {
     if (cyclotomicMax < cyclotomicTemp[i] ||
         !Polynomials::dividePolynomialByPolynomial(
             growthSeries_polynomialDenominator,
-            Polynomials::cyclotomicPolynomials[cyclotomicTemp[i]]))
+            Polynomials::cyclotomicPolynomials()[cyclotomicTemp[i]]))
       growthSeries_cyclotomicNumerator.push_back(cyclotomicTemp[i]);
 
     if (cyclotomicMax < cyclotomicTemp[i])
@@ -2460,7 +4669,7 @@ void CoxIter::growthSeries_parallel() {
   gs_polynomialDenominator[0][0] =
       1; // Master thread, empty set -> trivial subgroup
 
-#pragma omp parallel for default(none)                                         \
+#pragma omp parallel for if (useOpenMP) default(none)                          \
     shared(sizeMax, gs_symbolNumerator, gs_polynomialDenominator) private(     \
         exponent, symbol, threadId, temp_symbolDenominatorTemp)                \
         schedule(static, 1)
@@ -2502,62 +4711,292 @@ void CoxIter::growthSeries_parallel() {
   vector<unsigned int> cyclotomicTemp;
   unsigned int symbolDenominatorMax(gs_symbolNumerator[0].size() - 1);
 
-  for (unsigned int i(symbolDenominatorMax); i >= 2; i--) {
-    if (gs_symbolNumerator[0][i]) {
-      auto divisors(listDivisors(i, true));
-      divisors.push_back(i);
+  for (unsigned int i(symbolDenominatorMax); i >= 2; i--) {
+    if (gs_symbolNumerator[0][i]) {
+      auto divisors(listDivisors(i, true));
+      divisors.push_back(i);
+
+      for (unsigned int j(1); j <= gs_symbolNumerator[0][i]; j++)
+        cyclotomicTemp.insert(cyclotomicTemp.end(), divisors.begin(),
+                              divisors.end());
+    }
+  }
+
+  // --------------------------------------------------------------
+  // Simplifications
+  unsigned int cyclotomicTempSize(cyclotomicTemp.size()),
+      cyclotomicMax(Polynomials::cyclotomicPolynomials().size() - 1);
+  for (unsigned int i(0); i < cyclotomicTempSize; i++) {
+    if (cyclotomicMax < cyclotomicTemp[i] ||
+        !Polynomials::dividePolynomialByPolynomial(
+            growthSeries_polynomialDenominator,
+            Polynomials::cyclotomicPolynomials()[cyclotomicTemp[i]]))
+      growthSeries_cyclotomicNumerator.push_back(cyclotomicTemp[i]);
+
+    if (cyclotomicMax < cyclotomicTemp[i])
+      growthSeries_isFractionReduced = false;
+  }
+
+  // --------------------------------------------------------------
+  // Final stuff
+  sort(growthSeries_cyclotomicNumerator.begin(),
+       growthSeries_cyclotomicNumerator.end());
+  isGrowthSeriesComputed = true;
+}
+
+void CoxIter::get_growthSeries(vector<unsigned int> &cyclotomicNumerator,
+                               vector<mpz_class> &polynomialDenominator,
+                               bool &isReduced) {
+  if (!isGrowthSeriesComputed)
+    growthSeries();
+
+  cyclotomicNumerator = growthSeries_cyclotomicNumerator;
+  polynomialDenominator = growthSeries_polynomialDenominator;
+  isReduced = growthSeries_isFractionReduced;
+}
+
+bool CoxIter::get_isGrowthSeriesReduced() {
+  if (!isGrowthSeriesComputed)
+    growthSeries();
+
+  return growthSeries_isFractionReduced;
+}
+
+vector<mpz_class> CoxIter::get_growthSeries_denominator() {
+  if (!isGrowthSeriesComputed)
+    growthSeries();
+
+  return growthSeries_polynomialDenominator;
+}
+
+int CoxIter::growthRate_compare(const mpq_class &threshold) {
+  if (!isGraphExplored)
+    exploreGraph();
+
+  if (!isGraphsProductsComputed)
+    computeGraphsProducts();
+
+  if (threshold <= 0)
+    return 1;
+
+  /*
+   * 1/f(0) = 1 and the radius of convergence R of f is the smallest positive
+   * zero of 1/f. Hence: growth rate >= threshold iff 1/f has a zero in
+   * ]0, 1/threshold]
+   */
+  vector<pair<long int, vector<unsigned int>>> terms;
+  growthSeries_inverseTerms(terms);
+
+  mpq_class x;
+  return growthSeries_inverseSign(terms, 0, 1 / threshold, x);
+}
+
+bool CoxIter::growthRate_bounds(mpq_class &lower, mpq_class &upper,
+                                const unsigned int &iterations) {
+  if (!isGraphExplored)
+    exploreGraph();
+
+  if (!isGraphsProductsComputed)
+    computeGraphsProducts();
+
+  vector<pair<long int, vector<unsigned int>>> terms;
+  growthSeries_inverseTerms(terms);
+
+  // 1/f > 0 on ]0, xPositive] and 1/f(xNonPositive) <= 0
+  mpq_class xPositive(0), xNonPositive, x;
+
+  int result(growthSeries_inverseSign(terms, 0, 1, xNonPositive));
+
+  if (result == -1) {
+    error = "GROWTH_RATE_BOUNDS";
+    return false;
+  } else if (result == 0) // Radius of convergence > 1: finite group
+  {
+    lower = 0;
+    upper = 1;
+    return true;
+  }
+
+  /*
+   * Bisection. Proving that 1/f > 0 on ]xPositive, xPositive + step] is
+   * expensive close to the zero: if it fails, we try with a smaller step
+   */
+  mpq_class step(xNonPositive / 2), middle;
+  for (unsigned int i(0); i < iterations; i++) {
+    middle = (xPositive + xNonPositive) / 2;
+    if (growthSeries_inverseSign(terms, middle, middle, x, 0) == 1) {
+      xNonPositive = middle;
+      if (2 * step > xNonPositive - xPositive)
+        step = (xNonPositive - xPositive) / 2;
+      continue;
+    }
+
+    result = growthSeries_inverseSign(terms, xPositive, xPositive + step, x,
+                                      256);
+    if (result == 1) {
+      xNonPositive = x;
+      step = (xNonPositive - xPositive) / 2;
+    } else if (result == 0) {
+      xPositive += step;
+      if (2 * step > xNonPositive - xPositive)
+        step = (xNonPositive - xPositive) / 2;
+    } else
+      step /= 2;
+  }
+
+  if (xPositive == 0) {
+    error = "GROWTH_RATE_BOUNDS";
+    return false;
+  }
+
+  lower = 1 / xNonPositive;
+  upper = 1 / xPositive;
+
+  return true;
+}
+
+void CoxIter::growthSeries_inverseTerms(
+    vector<pair<long int, vector<unsigned int>>> &terms) const {
+  unsigned int sizeMax(graphsProductsCount_spherical.size());
+  vector<unsigned int> symbol;
+  unsigned int exponent;
+
+  terms.clear();
+  for (unsigned int size(1); size < sizeMax; size++) {
+    for (const auto &product : graphsProductsCount_spherical[size]) {
+      growthSeries_symbolExponentFromProduct(product.first, symbol, exponent);
+      terms.push_back(make_pair(
+          (long int)product.second * ((size % 2) ? -1 : 1), symbol));
+    }
+  }
+}
+
+void CoxIter::growthSeries_inverseEvaluate(
+    const vector<pair<long int, vector<unsigned int>>> &terms,
+    const mpq_class &x, mpz_class &positive, mpz_class &negative,
+    mpz_class &denominator) const {
+  /*
+   * The exponent of a product is the sum of the (n_i - 1), so that
+   * x^exponent / [n_1, ..., n_k] is the product of the
+   *    x^(n_i - 1) / [n_i] = p^(n_i - 1) / h_n_i
+   * where x = p/q and h_n = q^(n-1) + p q^(n-2) + ... + p^(n-1).
+   * Every term is written with the common denominator prod h_n^max_n
+   */
+  const mpz_class &p(x.get_num()), &q(x.get_den());
+
+  // Maximal power of each symbol
+  vector<unsigned int> powersMax;
+  for (const auto &term : terms) {
+    if (powersMax.size() < term.second.size())
+      powersMax.resize(term.second.size(), 0);
+
+    for (unsigned int n(2); n < term.second.size(); n++)
+      powersMax[n] = max(powersMax[n], term.second[n]);
+  }
+
+  unsigned int symbolMax(powersMax.size());
+  vector<mpz_class> h(symbolMax, 1), pPowers(symbolMax, 1);
+  for (unsigned int n(2); n < symbolMax; n++) {
+    pPowers[n] = pPowers[n - 1] * p; // p^(n-1)
+    h[n] = h[n - 1] * q + pPowers[n];
+  }
+
+  mpz_class power;
+  denominator = 1;
+  for (unsigned int n(2); n < symbolMax; n++) {
+    mpz_pow_ui(power.get_mpz_t(), h[n].get_mpz_t(), powersMax[n]);
+    denominator *= power;
+  }
+
+  positive = 0;
+  negative = 0;
+
+  for (const auto &term : terms) {
+    mpz_class value(term.first > 0 ? term.first : -term.first);
 
-      for (unsigned int j(1); j <= gs_symbolNumerator[0][i]; j++)
-        cyclotomicTemp.insert(cyclotomicTemp.end(), divisors.begin(),
-                              divisors.end());
+    for (unsigned int n(2); n < symbolMax; n++) {
+      unsigned int symbolPower(n < term.second.size() ? term.second[n] : 0);
+
+      mpz_pow_ui(power.get_mpz_t(), pPowers[n].get_mpz_t(), symbolPower);
+      value *= power;
+      mpz_pow_ui(power.get_mpz_t(), h[n].get_mpz_t(),
+                 powersMax[n] - symbolPower);
+      value *= power;
     }
-  }
 
-  // --------------------------------------------------------------
-  // Simplifications
-  unsigned int cyclotomicTempSize(cyclotomicTemp.size()),
-      cyclotomicMax(Polynomials::cyclotomicPolynomials.size() - 1);
-  for (unsigned int i(0); i < cyclotomicTempSize; i++) {
-    if (cyclotomicMax < cyclotomicTemp[i] ||
-        !Polynomials::dividePolynomialByPolynomial(
-            growthSeries_polynomialDenominator,
-            Polynomials::cyclotomicPolynomials[cyclotomicTemp[i]]))
-      growthSeries_cyclotomicNumerator.push_back(cyclotomicTemp[i]);
+    if (term.first > 0)
+      positive += value;
+    else
+      negative += value;
+  }
+}
 
-    if (cyclotomicMax < cyclotomicTemp[i])
-      growthSeries_isFractionReduced = false;
+int CoxIter::growthSeries_inverseSign(
+    const vector<pair<long int, vector<unsigned int>>> &terms,
+    const mpq_class &a, const mpq_class &b, mpq_class &x,
+    const unsigned int &evaluationsMax) const {
+  /*
+   * 1/f(x) = 1 + positive(x) - negative(x) where positive and negative are
+   * increasing. Hence on [a, b]:
+   *    1/f(x) >= 1 + positive(a) - negative(b)
+   */
+  struct Point {
+    mpq_class x;
+    mpz_class positive, negative, denominator;
+  };
+
+  auto evaluate = [this, &terms](Point &point) {
+    growthSeries_inverseEvaluate(terms, point.x, point.positive,
+                                 point.negative, point.denominator);
+  };
+
+  // Sign of 1 + positive(a) - negative(b)
+  auto lowerBoundSign = [](const Point &a, const Point &b) {
+    return sgn((a.denominator + a.positive) * b.denominator -
+               b.negative * a.denominator);
+  };
+
+  unsigned int evaluations(0);
+
+  Point left, right;
+  left.x = a;
+  right.x = b;
+  evaluate(left);
+  evaluate(right);
+
+  if (lowerBoundSign(right, right) <= 0) {
+    x = b;
+    return 1;
   }
 
-  // --------------------------------------------------------------
-  // Final stuff
-  sort(growthSeries_cyclotomicNumerator.begin(),
-       growthSeries_cyclotomicNumerator.end());
-  isGrowthSeriesComputed = true;
-}
+  vector<pair<Point, Point>> intervals(1, make_pair(left, right));
 
-void CoxIter::get_growthSeries(vector<unsigned int> &cyclotomicNumerator,
-                               vector<mpz_class> &polynomialDenominator,
-                               bool &isReduced) {
-  if (!isGrowthSeriesComputed)
-    growthSeries();
+  while (!intervals.empty()) {
+    left = intervals.back().first;
+    right = intervals.back().second;
+    intervals.pop_back();
 
-  cyclotomicNumerator = growthSeries_cyclotomicNumerator;
-  polynomialDenominator = growthSeries_polynomialDenominator;
-  isReduced = growthSeries_isFractionReduced;
-}
+    if (lowerBoundSign(left, right) > 0) // 1/f > 0 on [a, b]
+      continue;
 
-bool CoxIter::get_isGrowthSeriesReduced() {
-  if (!isGrowthSeriesComputed)
-    growthSeries();
+    if (++evaluations > evaluationsMax)
+      return -1;
 
-  return growthSeries_isFractionReduced;
-}
+    Point middle;
+    middle.x = (left.x + right.x) / 2;
+    evaluate(middle);
 
-vector<mpz_class> CoxIter::get_growthSeries_denominator() {
-  if (!isGrowthSeriesComputed)
-    growthSeries();
+    if (lowerBoundSign(middle, middle) <= 0) {
+      x = middle.x;
+      return 1;
+    }
 
-  return growthSeries_polynomialDenominator;
+    // Left part first, to find the smallest zero
+    intervals.push_back(make_pair(middle, right));
+    intervals.push_back(make_pair(left, middle));
+  }
+
+  return 0;
 }
 
 void CoxIter::growthSeries_symbolExponentFromProduct(
@@ -2723,6 +5162,8 @@ void CoxIter::growthSeries_symbolExponentFromProduct(
 }
 
 bool CoxIter::computeEulerCharacteristicFVector() {
+  StageTimer timer(stats.eulerCharacteristicTime);
+
   // variables de boucles
   size_t i, j, k, max;
   map<vector<vector<short unsigned int>>, unsigned int>::iterator itMap;
@@ -2742,7 +5183,7 @@ bool CoxIter::computeEulerCharacteristicFVector() {
   eulerCharacteristic_computations = "1";
 
   if (debug)
-    cout << "\nProducts of spherical graphs" << endl;
+    *out << "\nProducts of spherical graphs" << endl;
 
   fVector[dimension] = 1;
 
@@ -2757,7 +5198,7 @@ bool CoxIter::computeEulerCharacteristicFVector() {
       biTemp = 1;
 
       if (debug)
-        cout << "\t" << currentVerticesCount << ": ";
+        *out << "\t" << currentVerticesCount << ": ";
 
       // pour chaque type de graphe
       for (i = 0; i < 8; i++) {
@@ -2767,7 +5208,7 @@ bool CoxIter::computeEulerCharacteristicFVector() {
         for (j = 0; j < max; j++) {
           if (itMap->first[i][j]) {
             if (debug)
-              cout << (char)(i + 65) << "_" << (j + 1) << "^"
+              *out << (char)(i + 65) << "_" << (j + 1) << "^"
                    << itMap->first[i][j] << " | ";
 
             biOrderTemp = i_orderFiniteSubgraph(i, j + 1);
@@ -2786,7 +5227,7 @@ bool CoxIter::computeEulerCharacteristicFVector() {
         fVector[fVectorIndex] += itMap->second;
       }
       if (debug)
-        cout << "N: " << itMap->second << " / Order: " << biTemp.get_str()
+        *out << "N: " << itMap->second << " / Order: " << biTemp.get_str()
              << endl;
     }
 
@@ -2834,7 +5275,7 @@ void CoxIter::printEuclideanGraphsProducts(
        itMaps != graphsProductsCount->end(); ++itMaps) {
     // on parcourt les produits pour la taille donnée
     for (itMap = itMaps->begin(); itMap != itMaps->end(); ++itMap) {
-      cout << "\t";
+      *out << "\t";
       // pour chaque type de graphe
       for (i = 0; i < 8; i++) {
         max = (itMap->first[i]).size();
@@ -2842,54 +5283,54 @@ void CoxIter::printEuclideanGraphsProducts(
         // pour chaque taille
         for (j = 0; j < max; j++) {
           if (itMap->first[i][j])
-            cout << "T" << (char)(i + 65) << "_" << j << "^"
+            *out << "T" << (char)(i + 65) << "_" << j << "^"
                  << itMap->first[i][j] << " | ";
         }
       }
 
-      cout << "N: " << itMap->second << endl;
+      *out << "N: " << itMap->second << endl;
     }
   }
 }
 
 void CoxIter::printCoxeterMatrix() {
-  cout << "Coxeter matrix" << endl;
+  *out << "Coxeter matrix" << endl;
 
-  cout << "\tVertices: ";
+  *out << "\tVertices: ";
   for (vector<string>::const_iterator it(map_vertices_indexToLabel.begin());
        it != map_vertices_indexToLabel.end(); ++it)
-    cout << (it == map_vertices_indexToLabel.begin() ? "" : ", ") << *it;
-  cout << endl;
+    *out << (it == map_vertices_indexToLabel.begin() ? "" : ", ") << *it;
+  *out << endl;
 
   unsigned int i, j;
   if (ouputMathematicalFormat == "mathematica" ||
       ouputMathematicalFormat == "gap") {
-    cout << "\t[";
+    *out << "\t[";
     for (i = 0; i < verticesCount; i++) {
-      cout << (i ? "," : "") << "[";
+      *out << (i ? "," : "") << "[";
       for (j = 0; j < verticesCount; j++) {
-        cout << (j ? "," : "")
+        *out << (j ? "," : "")
              << (i == j ? 1
                         : (coxeterMatrix[i][j] < 2 ? 0 : coxeterMatrix[i][j]));
       }
-      cout << "]";
+      *out << "]";
     }
-    cout << "]" << endl;
+    *out << "]" << endl;
   } else {
     for (i = 0; i < verticesCount; i++) {
-      cout << "\t";
+      *out << "\t";
       for (j = 0; j < verticesCount; j++) {
-        cout << (j ? "," : "")
+        *out << (j ? "," : "")
              << (i == j ? 1
                         : (coxeterMatrix[i][j] < 2 ? 0 : coxeterMatrix[i][j]));
       }
-      cout << endl;
+      *out << endl;
     }
   }
 }
 
 void CoxIter::printCoxeterGraph() {
-  cout << "Coxeter graph:\n\t[" << get_coxeterGraph() << "]\n" << endl;
+  *out << "Coxeter graph:\n\t[" << get_coxeterGraph() << "]\n" << endl;
 }
 
 void CoxIter::printGramMatrix() {
@@ -2902,7 +5343,14 @@ void CoxIter::printGramMatrix() {
   else if (ouputMathematicalFormat == "pari")
     printGramMatrix_PARI();
   else
-    cout << "Gram matrix  \n\t" << get_gramMatrix() << "\n" << endl;
+    *out << "Gram matrix  \n\t" << get_gramMatrix() << "\n" << endl;
+
+  computeCyclicProducts();
+  *out << "Field generated by the entries: "
+       << (isGramMatrixFieldKnown ? gramMatrixField : "?") << endl;
+  *out << "Field generated by the cyclic products: "
+       << (cyclicProductsField != "" ? cyclicProductsField : "?") << "\n"
+       << endl;
 
   unsigned int i, j;
   for (i = 0; i < verticesCount; i++) {
@@ -2910,7 +5358,7 @@ void CoxIter::printGramMatrix() {
       if (coxeterMatrix[i][j] == 1 &&
           weightsDotted.find(linearizationMatrix_index(j, i, verticesCount)) ==
               weightsDotted.end()) {
-        cout << "l" << j << "m" << i
+        *out << "l" << j << "m" << i
              << ": weight of the dotted line between hyperplanes "
              << map_vertices_indexToLabel[j] << " and "
              << map_vertices_indexToLabel[i] << endl;
@@ -2918,35 +5366,35 @@ void CoxIter::printGramMatrix() {
     }
   }
 
-  cout << endl;
+  *out << endl;
 }
 
 void CoxIter::printGramMatrix_GAP() {
-  cout << "Gram matrix (GAP): \n\t" << get_gramMatrix_GAP() << "\n" << endl;
+  *out << "Gram matrix (GAP): \n\t" << get_gramMatrix_GAP() << "\n" << endl;
 }
 
 void CoxIter::printGramMatrix_Mathematica() {
-  cout << "Gram matrix (Mathematica): \n\t" << get_gramMatrix_Mathematica()
+  *out << "Gram matrix (Mathematica): \n\t" << get_gramMatrix_Mathematica()
        << "\n"
        << endl;
 }
 
 void CoxIter::printGramMatrix_PARI() {
-  cout << "Gram matrix (PARI): \n\t" << get_gramMatrix_PARI() << "\n" << endl;
+  *out << "Gram matrix (PARI): \n\t" << get_gramMatrix_PARI() << "\n" << endl;
 }
 
 void CoxIter::printGramMatrix_LaTeX() {
-  cout << "Gram matrix (LaTeX): \n\t" << get_gramMatrix_LaTeX() << "\n" << endl;
+  *out << "Gram matrix (LaTeX): \n\t" << get_gramMatrix_LaTeX() << "\n" << endl;
 }
 
 void CoxIter::printEdgesVisitedMatrix() {
   unsigned int i, j;
-  cout << "Matrix of visited edges" << endl;
+  *out << "Matrix of visited edges" << endl;
 
   for (i = 0; i < verticesCount; i++) {
     for (j = 0; j < verticesCount; j++)
-      cout << (visitedEdges[i][j] ? 1 : 0) << " ";
-    cout << endl;
+      *out << (visitedEdges[i][j] ? 1 : 0) << " ";
+    *out << endl;
   }
 }
 
@@ -3340,6 +5788,12 @@ string CoxIter::get_gramMatrixField() const {
   return (isGramMatrixFieldKnown ? gramMatrixField : "");
 }
 
+vector<CyclicProduct> CoxIter::get_cyclicProducts() const {
+  return cyclicProducts;
+}
+
+string CoxIter::get_cyclicProductsField() const { return cyclicProductsField; }
+
 MPZ_rational CoxIter::get_brEulerCaracteristic() const {
   return brEulerCaracteristic;
 }
@@ -3358,10 +5812,380 @@ bool CoxIter::get_bWriteInfo() const { return bWriteInfo; }
 
 void CoxIter::set_bWriteInfo(const bool &bNewValue) { bWriteInfo = bNewValue; }
 
+ostream &CoxIter::get_output() const { return *out; }
+
+void CoxIter::set_output(ostream &output) { out = &output; }
+
 bool CoxIter::get_debug() const { return debug; }
 
+bool CoxIter::get_useOpenMP() const { return useOpenMP; }
+
+bool CoxIter::get_useSymmetries() const { return useSymmetries; }
+
+bool CoxIter::get_memoryBounded() const { return memoryBounded; }
+
+bool CoxIter::get_streamedCheck() const { return streamedCheck; }
+
 vector<unsigned int> CoxIter::get_fVector() const { return fVector; }
 
+CoxIter_Stats CoxIter::get_stats() const {
+  CoxIter_Stats statsWithMemory(stats);
+
+#ifdef WIN32
+  statsWithMemory.peakMemory = 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+#ifdef __APPLE__
+    statsWithMemory.peakMemory = usage.ru_maxrss / 1024; // In bytes on macOS
+#else
+    statsWithMemory.peakMemory = usage.ru_maxrss;
+#endif
+  else
+    statsWithMemory.peakMemory = 0;
+#endif
+
+  return statsWithMemory;
+}
+
+CoxIter_Results CoxIter::get_results() const {
+  CoxIter_Results results;
+
+  results.dimension = dimension;
+  results.isDimensionGuessed = isDimensionGuessed;
+
+  results.eulerCharacteristic = brEulerCaracteristic;
+  results.fVector = fVector;
+  results.fVectorAlternateSum = fVectorAlternateSum;
+  results.verticesAtInfinityCount = verticesAtInfinityCount;
+
+  results.isCocompact = isCocompact;
+  results.isFiniteCovolume = isFiniteCovolume;
+
+  results.isGrowthSeriesComputed = isGrowthSeriesComputed;
+  if (isGrowthSeriesComputed) {
+    results.growthSeries_cyclotomicNumerator = growthSeries_cyclotomicNumerator;
+    results.growthSeries_polynomialDenominator =
+        growthSeries_polynomialDenominator;
+    results.growthSeries_isFractionReduced = growthSeries_isFractionReduced;
+  }
+
+  return results;
+}
+
+void CoxIter::set_results(const CoxIter_Results &results) {
+  if (!dimension || results.isDimensionGuessed) {
+    dimension = results.dimension;
+    isDimensionGuessed = results.isDimensionGuessed;
+  }
+
+  if (results.isEulerCharacteristicComputed) {
+    brEulerCaracteristic = results.eulerCharacteristic;
+    fVector = results.fVector;
+    fVectorAlternateSum = results.fVectorAlternateSum;
+    verticesAtInfinityCount = results.verticesAtInfinityCount;
+  }
+
+  if (results.isCocompact != -2)
+    isCocompact = results.isCocompact;
+
+  if (results.isFiniteCovolume != -2)
+    isFiniteCovolume = results.isFiniteCovolume;
+
+  if (results.isGrowthSeriesComputed) {
+    growthSeries_cyclotomicNumerator = results.growthSeries_cyclotomicNumerator;
+    growthSeries_polynomialDenominator =
+        results.growthSeries_polynomialDenominator;
+    growthSeries_isFractionReduced = results.growthSeries_isFractionReduced;
+    growthSeries_raw = "";
+    isGrowthSeriesComputed = true;
+  }
+}
+
+vector<vector<unsigned int>>
+CoxIter::canonical_edgesCodes(vector<string> &labels) const {
+  // Label of an edge: order, or "1:weight" for a dotted edge with a weight
+  auto edgeLabel = [this](const unsigned int &i, const unsigned int &j) {
+    if (coxeterMatrix[i][j] == 1) {
+      auto weight(weightsDotted.find(
+          linearizationMatrix_index(min(i, j), max(i, j), verticesCount)));
+      if (weight != weightsDotted.end())
+        return "1:" + weight->second;
+    }
+
+    return to_string(coxeterMatrix[i][j]);
+  };
+
+  labels.clear();
+  for (unsigned int i(0); i < verticesCount; i++) {
+    for (unsigned int j(i + 1); j < verticesCount; j++)
+      labels.push_back(edgeLabel(i, j));
+  }
+
+  sort(labels.begin(), labels.end());
+  labels.erase(unique(labels.begin(), labels.end()), labels.end());
+
+  vector<vector<unsigned int>> codes(verticesCount,
+                                     vector<unsigned int>(verticesCount, 0));
+  for (unsigned int i(0); i < verticesCount; i++) {
+    for (unsigned int j(i + 1); j < verticesCount; j++) {
+      codes[i][j] = codes[j][i] =
+          lower_bound(labels.begin(), labels.end(), edgeLabel(i, j)) -
+          labels.begin();
+    }
+  }
+
+  return codes;
+}
+
+void CoxIter::canonical_refine(const vector<vector<unsigned int>> &codes,
+                               const unsigned int &labelsCount,
+                               vector<unsigned int> &colours) const {
+  unsigned int coloursCount(0);
+  vector<vector<unsigned int>> signatures(verticesCount);
+  vector<unsigned int> vertices(verticesCount);
+
+  while (true) {
+    // Signature of a vertex: its colour and the colours of the other vertices
+    // together with the corresponding edges
+    for (unsigned int i(0); i < verticesCount; i++) {
+      signatures[i].resize(1);
+      signatures[i][0] = colours[i];
+
+      for (unsigned int j(0); j < verticesCount; j++) {
+        if (i != j)
+          signatures[i].push_back(colours[j] * labelsCount + codes[i][j]);
+      }
+
+      sort(signatures[i].begin() + 1, signatures[i].end());
+      vertices[i] = i;
+    }
+
+    sort(vertices.begin(), vertices.end(),
+         [&signatures](const unsigned int &a, const unsigned int &b) {
+           return signatures[a] < signatures[b];
+         });
+
+    // New colours: indices of the signatures
+    unsigned int colour(0);
+    for (unsigned int i(0); i < verticesCount; i++) {
+      if (i && signatures[vertices[i]] != signatures[vertices[i - 1]])
+        colour++;
+
+      colours[vertices[i]] = colour;
+    }
+
+    // The partition is equitable if no cell was split
+    if (colour + 1 == coloursCount)
+      return;
+
+    coloursCount = colour + 1;
+  }
+}
+
+void CoxIter::canonical_search(
+    const vector<vector<unsigned int>> &codes, const unsigned int &labelsCount,
+    vector<unsigned int> colours, vector<unsigned int> &path,
+    vector<unsigned int> &best, vector<unsigned int> &bestLabeling,
+    vector<vector<unsigned int>> &automorphisms) const {
+  canonical_refine(codes, labelsCount, colours);
+
+  // First cell with more than one vertex
+  vector<unsigned int> cellsSizes(verticesCount, 0);
+  for (const auto &colour : colours)
+    cellsSizes[colour]++;
+
+  unsigned int cell(0);
+  while (cell < verticesCount && cellsSizes[cell] <= 1)
+    cell++;
+
+  if (cell == verticesCount) // Discrete partition: vertex i is at colours[i]
+  {
+    vector<unsigned int> labeling(verticesCount);
+    for (unsigned int i(0); i < verticesCount; i++)
+      labeling[colours[i]] = i;
+
+    vector<unsigned int> matrix;
+    matrix.reserve(verticesCount * (verticesCount - 1) / 2);
+    for (unsigned int i(0); i < verticesCount; i++) {
+      for (unsigned int j(i + 1); j < verticesCount; j++)
+        matrix.push_back(codes[labeling[i]][labeling[j]]);
+    }
+
+    if (best.empty() || matrix < best) {
+      best = matrix;
+      bestLabeling = labeling;
+    } else if (matrix == best) // Automorphism: labeling[k] -> bestLabeling[k]
+    {
+      vector<unsigned int> automorphism(verticesCount);
+      for (unsigned int k(0); k < verticesCount; k++)
+        automorphism[labeling[k]] = bestLabeling[k];
+
+      automorphisms.push_back(automorphism);
+    }
+
+    return;
+  }
+
+  // Orbits (union-find) under the automorphisms which fix the path
+  vector<unsigned int> orbits(verticesCount);
+  vector<bool> isOrbitExplored(verticesCount, false);
+  size_t automorphismsUsed(0);
+
+  for (unsigned int i(0); i < verticesCount; i++)
+    orbits[i] = i;
+
+  auto orbit = [&orbits](unsigned int v) {
+    while (orbits[v] != v)
+      v = orbits[v] = orbits[orbits[v]];
+
+    return v;
+  };
+
+  // Each vertex of the cell is individualized (one per orbit)
+  for (unsigned int i(0); i < verticesCount; i++) {
+    if (colours[i] != cell)
+      continue;
+
+    // Automorphisms found since the last vertex
+    for (; automorphismsUsed < automorphisms.size(); automorphismsUsed++) {
+      const vector<unsigned int> &automorphism(
+          automorphisms[automorphismsUsed]);
+
+      bool isFixingPath(true);
+      for (const auto &v : path) {
+        if (automorphism[v] != v) {
+          isFixingPath = false;
+          break;
+        }
+      }
+
+      if (!isFixingPath)
+        continue;
+
+      for (unsigned int v(0); v < verticesCount; v++) {
+        const unsigned int o1(orbit(v)), o2(orbit(automorphism[v]));
+        if (o1 != o2) {
+          orbits[o2] = o1;
+          isOrbitExplored[o1] = isOrbitExplored[o1] || isOrbitExplored[o2];
+        }
+      }
+    }
+
+    if (isOrbitExplored[orbit(i)])
+      continue;
+
+    vector<unsigned int> coloursIndividualized(colours);
+    for (auto &colour : coloursIndividualized)
+      colour = 2 * colour + 1;
+    coloursIndividualized[i] = 2 * cell;
+
+    path.push_back(i);
+    canonical_search(codes, labelsCount, coloursIndividualized, path, best,
+                     bestLabeling, automorphisms);
+    path.pop_back();
+
+    isOrbitExplored[orbit(i)] = true;
+  }
+}
+
+void CoxIter::canonical_compute(vector<string> &labels,
+                                vector<unsigned int> &matrix,
+                                vector<unsigned int> &labeling) const {
+  const vector<vector<unsigned int>> codes(canonical_edgesCodes(labels));
+
+  matrix.clear();
+  labeling.clear();
+  if (!verticesCount)
+    return;
+
+  vector<unsigned int> path;
+  vector<vector<unsigned int>> automorphisms;
+  canonical_search(codes, max(labels.size(), size_t(1)),
+                   vector<unsigned int>(verticesCount, 0), path, matrix,
+                   labeling, automorphisms);
+}
+
+string CoxIter::get_canonicalForm() const {
+  vector<unsigned int> labeling;
+  return get_canonicalForm(labeling);
+}
+
+string CoxIter::get_canonicalForm(vector<unsigned int> &labeling) const {
+  vector<string> labels;
+  vector<unsigned int> matrix;
+  canonical_compute(labels, matrix, labeling);
+
+  string canonicalForm(to_string(verticesCount) + ";" + to_string(dimension) +
+                       ";" + implode(",", labels) + ";");
+  for (const auto &code : matrix)
+    canonicalForm += to_string(code) + ",";
+
+  return canonicalForm;
+}
+
+vector<unsigned int> CoxIter::get_canonicalLabeling() const {
+  vector<string> labels;
+  vector<unsigned int> matrix, labeling;
+  canonical_compute(labels, matrix, labeling);
+
+  return labeling;
+}
+
+uint64_t CoxIter::get_canonicalHash() const {
+  return canonicalHash(get_canonicalForm());
+}
+
+uint64_t CoxIter::canonicalHash(const string &canonicalForm) {
+  uint64_t hash(14695981039346656037ULL);
+
+  for (const char &c : canonicalForm) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+bool CoxIter::isIsomorphicTo(const CoxIter &graph) const {
+  vector<unsigned int> isomorphism;
+  return isIsomorphicTo(graph, isomorphism);
+}
+
+bool CoxIter::isIsomorphicTo(const CoxIter &graph,
+                             vector<unsigned int> &isomorphism) const {
+  if (verticesCount != graph.verticesCount)
+    return false;
+
+  vector<string> labels, graphLabels;
+  vector<unsigned int> matrix, graphMatrix, labeling, graphLabeling;
+  canonical_compute(labels, matrix, labeling);
+  graph.canonical_compute(graphLabels, graphMatrix, graphLabeling);
+
+  if (labels != graphLabels || matrix != graphMatrix)
+    return false;
+
+  isomorphism.resize(verticesCount);
+  for (unsigned int k(0); k < verticesCount; k++)
+    isomorphism[labeling[k]] = graphLabeling[k];
+
+  return true;
+}
+
+vector<vector<unsigned int>> CoxIter::get_automorphismsGenerators() const {
+  vector<string> labels;
+  const vector<vector<unsigned int>> codes(canonical_edgesCodes(labels));
+
+  vector<unsigned int> path, matrix, labeling;
+  vector<vector<unsigned int>> automorphisms;
+  if (verticesCount)
+    canonical_search(codes, max(labels.size(), size_t(1)),
+                     vector<unsigned int>(verticesCount, 0), path, matrix,
+                     labeling, automorphisms);
+
+  return automorphisms;
+}
+
 vector<unsigned int> CoxIter::get_infSeqFVectorsUnits() const {
   return infSeqFVectorsUnits;
 }
@@ -3450,15 +6274,11 @@ void CoxIter::set_useOpenMP(const bool &value) {
 #endif
 }
 
-void CoxIter::set_sdtOutToFile(const string &filename) {
-  string outputCoutFilename(filename);
-  outCout = new ofstream(outputCoutFilename.c_str());
+void CoxIter::set_useSymmetries(const bool &value) { useSymmetries = value; }
 
-  if (outCout->is_open()) {
-    sBufOld = cout.rdbuf(outCout->rdbuf());
-    bCoutFile = true;
-  }
-}
+void CoxIter::set_memoryBounded(const bool &value) { memoryBounded = value; }
+
+void CoxIter::set_streamedCheck(const bool &value) { streamedCheck = value; }
 
 void CoxIter::set_dimension(const unsigned int &dimension_) {
   dimension = dimension_;
@@ -3485,6 +6305,179 @@ void CoxIter::set_coxeterMatrix(const vector<vector<unsigned int>> &iMat) {
   maximalSubgraphRank = dimension ? dimension : verticesCount;
 }
 
+void CoxIter::set_coxeterMatrix_index2(
+    const vector<vector<unsigned int>> &matrix, const unsigned int &vertex,
+    const vector<unsigned int> &originVertices) {
+  if (!isGraphExplored) {
+    set_coxeterMatrix(matrix);
+    return;
+  }
+
+  // The lists of the current graph are kept (not deleted by initializations)
+  GraphsList *graphsListOld_spherical(graphsList_spherical),
+      *graphsListOld_euclidean(graphsList_euclidean);
+  graphsList_spherical = graphsList_euclidean = nullptr;
+
+  const unsigned int verticesCountOld(verticesCount);
+
+  set_coxeterMatrix(matrix);
+
+  StageTimer timer(stats.exploreGraphTime);
+
+  // Index of the vertices in the new graph and index of their images under t0
+  vector<short unsigned int> verticesMap(verticesCountOld),
+      verticesMapImage(verticesCountOld);
+  for (unsigned int i(0); i < verticesCountOld; i++)
+    verticesMap[i] = verticesMapImage[i] = i > vertex ? i - 1 : i;
+
+  for (unsigned int k(0); k < originVertices.size(); k++)
+    verticesMapImage[originVertices[k]] = verticesCountOld - 1 + k;
+
+  vector<vector<unsigned int>> neighbours(verticesCount);
+  for (unsigned int i(0); i < verticesCount; i++) {
+    for (unsigned int j(0); j < verticesCount; j++) {
+      if (coxeterMatrix[i][j] != 2)
+        neighbours[i].push_back(j);
+    }
+  }
+
+  auto linkableVertices = [this, &neighbours](
+                              const vector<short unsigned int> &vertices) {
+    vector<bool> linkable(verticesCount, true);
+
+    for (const auto &v : vertices) {
+      for (const auto &i : neighbours[v])
+        linkable[i] = false;
+      linkable[v] = false;
+    }
+
+    return linkable;
+  };
+
+  CoxIter ciDouble; // To find the graphs which contain s and t0 * s * t0
+
+  for (unsigned int k(0); k < 2; k++) {
+    GraphsList *graphsList(k ? graphsList_euclidean : graphsList_spherical);
+
+    for (GraphsListIterator grIt(k ? graphsListOld_euclidean
+                                   : graphsListOld_spherical);
+         grIt.ptr; ++grIt) {
+      vector<short unsigned int> vertices, verticesImage;
+      unsigned int movedCount(0), moved(0);
+
+      for (const auto &v : grIt.ptr->vertices) {
+        if (v == vertex)
+          break;
+
+        vertices.push_back(verticesMap[v]);
+        verticesImage.push_back(verticesMapImage[v]);
+
+        if (verticesMap[v] != verticesMapImage[v]) {
+          movedCount++;
+          moved = v;
+        }
+      }
+
+      if (vertices.size() != grIt.ptr->vertices.size()) // Contains t0
+        continue;
+
+      graphsList->addGraph(*grIt.ptr, verticesMap, linkableVertices(vertices));
+
+      if (!movedCount) // Invariant under t0
+        continue;
+
+      graphsList->addGraph(*grIt.ptr, verticesMapImage,
+                           linkableVertices(verticesImage));
+
+      /*
+       * A connected graph which contains s and t0 * s' * t0 with s != s' is a
+       * TA1 (the edge is bold or dotted, see Index2::removeVertex). Otherwise,
+       * it contains s, t0 * s * t0 and vertices which commute with t0: if we
+       * remove t0 * s * t0, we get a spherical graph of the current graph.
+       */
+      if (k || movedCount != 1)
+        continue;
+
+      const unsigned int s(verticesMap[moved]), sImage(verticesMapImage[moved]);
+      const bool isLinked(coxeterMatrix[s][sImage] != 2);
+
+      // s and t0 * s * t0 have the same neighbours in the graph
+      vector<short unsigned int> sNeighbours;
+      for (const auto &v : vertices) {
+        if (coxeterMatrix[s][v] != 2)
+          sNeighbours.push_back(v);
+      }
+
+      if (sNeighbours.size() >= 2 || (isLinked && sNeighbours.size() == 1)) {
+        // There is a cycle: this has to be a TAn
+        if (sNeighbours.size() > 2 ||
+            vertices.size() != sNeighbours.size() + 1 ||
+            (sNeighbours.size() == 2) == isLinked)
+          continue;
+      } else if (sNeighbours.size() == 1 && vertices.size() > 2) {
+        // Two leaves attached to the same vertex: the vertex is of degree at
+        // most 3 (or 4, for the TD4)
+        unsigned int degree(0);
+        for (const auto &v : vertices) {
+          if (coxeterMatrix[sNeighbours[0]][v] != 2)
+            degree++;
+        }
+
+        if (coxeterMatrix[s][sNeighbours[0]] != 3 || degree > 3 ||
+            (degree == 3 && vertices.size() != 4))
+          continue;
+      }
+
+      vertices.push_back(sImage);
+
+      const unsigned int verticesDoubleCount(vertices.size());
+      vector<vector<unsigned int>> matrixDouble(
+          verticesDoubleCount, vector<unsigned int>(verticesDoubleCount, 2));
+      for (unsigned int i(0); i < verticesDoubleCount; i++) {
+        for (unsigned int j(0); j < verticesDoubleCount; j++)
+          matrixDouble[i][j] = coxeterMatrix[vertices[i]][vertices[j]];
+      }
+
+      ciDouble.set_coxeterMatrix(matrixDouble);
+      ciDouble.exploreGraph();
+
+      const vector<bool> linkable(linkableVertices(vertices));
+      for (unsigned int l(0); l < 2; l++) {
+        GraphsListN &graphsDouble(
+            (l ? ciDouble.graphsList_euclidean : ciDouble.graphsList_spherical)
+                ->graphs[verticesDoubleCount]);
+
+        for (size_t i(0); i < graphsDouble.size(); i++)
+          (l ? graphsList_euclidean : graphsList_spherical)
+              ->addGraph(*graphsDouble.next(i), vertices, linkable);
+      }
+    }
+  }
+
+  // TA1 with s and t0 * s' * t0
+  for (const auto &i : originVertices) {
+    for (const auto &j : originVertices) {
+      if (i != j && !coxeterMatrix[verticesMap[i]][verticesMapImage[j]]) {
+        vector<short unsigned int> vertices;
+        vertices.push_back(verticesMap[i]);
+        vertices.push_back(verticesMapImage[j]);
+
+        graphsList_euclidean->addGraph(vertices, linkableVertices(vertices), 0,
+                                       false, 0, 0, 0);
+      }
+    }
+  }
+
+  delete graphsListOld_spherical;
+  delete graphsListOld_euclidean;
+
+  stats.sphericalGraphsCount = graphsList_spherical->totalGraphsCount;
+  stats.euclideanGraphsCount = graphsList_euclidean->totalGraphsCount;
+
+  computeGraphsIds();
+  isGraphExplored = true;
+}
+
 void CoxIter::set_ouputMathematicalFormat(const string &format) {
   ouputMathematicalFormat = format;
 }
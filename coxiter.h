@@ -36,6 +36,7 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include "graphs.list.h"
 #include "graphs.list.iterator.h"
+#include "graphs.product.arena.h"
 #include "graphs.product.h"
 #include "graphs.product.set.h"
 #ifndef _COMPILE_WITHOUT_REGEXP_
@@ -46,12 +47,16 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 #include "lib/polynomials.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -66,28 +71,124 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 #else
 inline unsigned int omp_get_thread_num() { return 0; }
 inline unsigned int omp_get_max_threads() { return 1; }
+inline unsigned int omp_get_num_threads() { return 1; }
 #endif
 
 using namespace std;
 using namespace MathTools;
 
+/*! \struct CoxIter_Results
+ * \brief Invariants of the group, which do not depend on the labelling of the
+ * vertices (see CoxIter::get_results and CoxIter::set_results)
+ */
+struct CoxIter_Results {
+  unsigned int dimension;  ///< Dimension (given or guessed)
+  bool isDimensionGuessed; ///< If the dimension was guessed
+
+  bool isEulerCharacteristicComputed; ///< If the following four are known
+  MPZ_rational eulerCharacteristic;   ///< Euler characteristic
+  vector<unsigned int> fVector;       ///< f-vector
+  int fVectorAlternateSum; ///< Alternating sum of the components of the
+                           ///< f-vector
+  unsigned int verticesAtInfinityCount; ///< Number of vertices at infinity
+
+  int isCocompact;      ///< 1: yes, 0: no, -1: don't know, -2: not tested
+  int isFiniteCovolume; ///< 1: yes, 0: no, -1: don't know, -2: not tested
+
+  bool isGrowthSeriesComputed; ///< If the following three are known
+  vector<unsigned int> growthSeries_cyclotomicNumerator; ///< Numerator
+  vector<mpz_class> growthSeries_polynomialDenominator;  ///< Denominator
+  bool growthSeries_isFractionReduced; ///< If the fraction is reduced
+
+  int canBeFiniteCovolume; ///< 1: yes, 0: no, -2: not tested (only set by
+                           ///< CoxIter::analyse)
+  int isArithmetic; ///< 1: yes, 0: no, -1: don't know, -2: not tested (only
+                    ///< set by CoxIter::analyse)
+
+  CoxIter_Results()
+      : dimension(0), isDimensionGuessed(false),
+        isEulerCharacteristicComputed(false), eulerCharacteristic(0),
+        fVectorAlternateSum(0), verticesAtInfinityCount(0), isCocompact(-2),
+        isFiniteCovolume(-2), isGrowthSeriesComputed(false),
+        growthSeries_isFractionReduced(false), canBeFiniteCovolume(-2),
+        isArithmetic(-2) {}
+};
+
+/*! \struct CoxIter_Analyses
+ * \brief Computations asked to CoxIter::analyse
+ */
+struct CoxIter_Analyses {
+  bool eulerCharacteristic; ///< Euler characteristic and f-vector
+  bool cocompactness;       ///< Is the group cocompact?
+  bool finiteCovolume;      ///< Is the group of finite covolume?
+  bool canBeFiniteCovolume; ///< Fast test of the infinite covolume
+  bool growthSeries;        ///< Growth series
+  bool arithmeticity; ///< Is the group arithmetic? (implies cocompactness)
+
+  CoxIter_Analyses()
+      : eulerCharacteristic(true), cocompactness(false),
+        finiteCovolume(false), canBeFiniteCovolume(false),
+        growthSeries(false), arithmeticity(false) {}
+};
+
+/*! \struct CoxIter_Stats
+ * \brief Instrumentation of the computations (see CoxIter::get_stats)
+ *
+ * The times are measured with a monotonic clock, in seconds. They are
+ * inclusive: for example, computeGraphsProducts explores the graph if it was
+ * not done before.
+ */
+struct CoxIter_Stats {
+  double exploreGraphTime;        ///< exploreGraph
+  double graphsProductsTime;      ///< computeGraphsProducts
+  double canBeFiniteCovolumeTime; ///< canBeFiniteCovolume
+  double cocompactnessTime;       ///< isGraphCocompact
+  double finiteCovolumeTime;      ///< checkCovolumeFiniteness
+  double eulerCharacteristicTime; ///< computeEulerCharacteristicFVector
+  double growthSeriesTime;        ///< growthSeries
+
+  size_t sphericalGraphsCount; ///< Number of connected spherical graphs
+  size_t euclideanGraphsCount; ///< Number of connected euclidean graphs
+  unsigned long int productsCount; ///< Number of graphs products enumerated
+  unsigned long int footprintsCount; ///< Number of distinct products (i.e. of
+                                     ///< footprints)
+  unsigned long int extensionTestsCount; ///< Number of pairs (product, bigger
+                                         ///< product) tested for the
+                                         ///< cocompactness and finite covolume
+  unsigned long int isSubgraphOfCount; ///< Number of calls to isSubgraphOf
+
+  long int peakMemory; ///< Peak resident memory of the process, in kB (0 if
+                       ///< unknown)
+};
+
+/*! \struct CyclicProduct
+ * \brief Product of the entries 2*G(i,j) along a cycle of the graph
+ *
+ * Only the number of edges of each weight is kept (sparse representation)
+ */
+struct CyclicProduct {
+  vector<unsigned int> cycle; ///< Vertices of the cycle
+  map<unsigned int, unsigned int>
+      orders; ///< Number of edges of each order (0 for bold edges)
+};
+
 class CoxIter {
 private:
   string error; ///< Error code
   bool debug;   ///< If true, prints additionnal information
 
   bool useOpenMP; ///< Use OpenMP
+  bool useSymmetries; ///< Enumerate the graphs products up to the
+                      ///< automorphisms of the graph
+  bool memoryBounded; ///< Memory-bounded mode (see set_memoryBounded)
+  bool streamedCheck; ///< Streamed check (see set_streamedCheck)
 
   // -----------------------------------------------------------
   // I/O
   bool bWriteInfo; ///< If we want to write informations (false if CoxIter is
                    ///< used "as a plugin")
-
-  // -----------------------------------------------------------
-  // Redirection cout to a file
-  bool bCoutFile;     ///< True if we want to redirect cout to a file
-  ofstream *outCout;  ///< Flow to the file
-  streambuf *sBufOld; ///< To reset the cout, at the end
+  ostream *out;    ///< Where the informations, the debug and the print*
+                   ///< functions write (default: cout; see set_output)
 
   string ouputMathematicalFormat; ///< Format for mathematical output
                                   ///< (generic, mathematica)
@@ -120,6 +221,8 @@ private:
   int isFiniteCovolume; ///< 1 If finite covolume, 0 if not, -1 if don't know
                         ///< (or cannot know), -2 if not tested
 
+  CoxIter_Stats stats; ///< Timers and counters
+
   vector<string> verticesToRemove; ///< Vertices to be removed
   vector<string> vertices;         ///< Vertices to be taken
 
@@ -139,6 +242,13 @@ private:
   string gramMatrixField; ///< Field generated by the entries of the Gram matrix
   bool isGramMatrixFieldKnown; ///< True if the field was determined
 
+  bool isCyclicProductsComputed; ///< True if we computed the cyclic products
+  vector<CyclicProduct>
+      cyclicProducts; ///< Cyclic products of the fundamental cycles of a
+                      ///< spanning forest
+  string cyclicProductsField; ///< Field generated by the cyclic products (or
+                              ///< "" if unknown)
+
   GraphsList *graphsList_spherical; ///< Pointer to the list of spherical graphs
   GraphsList *graphsList_euclidean; ///< Pointer to the list of euclidean graphs
 
@@ -147,6 +257,9 @@ private:
   unsigned int infSeq_s0; /// (ultra)parallel hyperplane, will be conjugate
   vector<unsigned int> infSeqFVectorsUnits;  ///< Components of the f-vector
   vector<unsigned int> infSeqFVectorsPowers; ///< Components of the f-vector
+  bool isInfSeqInGraphsProducts; ///< True if computeGraphsProducts also does
+                                 ///< the computations related to the
+                                 ///< infinite sequence (see IS_computations)
 
   // -----------------------------------------------------------
   // Graphs products
@@ -161,6 +274,29 @@ private:
    */
   vector<vector<GraphsProductSet>> graphsProducts;
 
+  vector<Graph *> graphsById; ///< Connected graphs, sorted (see Graph::id): the
+                              ///< products store the ids of their graphs
+
+  bool isGraphsProductsIds; ///< True if the products [0], [1], [2] are stored
+                            ///< in graphsProductsIds (memory-bounded mode)
+  bool isCheckStreamed;     ///< True if only graphsProductsExtensions is kept
+                            ///< (streamed check)
+
+  /*! \var graphsProductsIds(vector< GraphsProductArena >)
+   * Same as graphsProducts, in the memory-bounded mode
+   */
+  vector<GraphsProductArena> graphsProductsIds;
+
+  /*! \var graphsProductsExtensions
+   * Streamed check: for each spherical product of codimension 1 (given by its
+   * sorted vertices), number of spherical and euclidean products of
+   * codimension 0 which contain it
+   */
+  map<vector<short unsigned int>, pair<unsigned int, unsigned int>>
+      graphsProductsExtensions;
+  array<size_t, 3> graphsProductsStreamedCount; ///< Streamed check: number of
+                                                ///< products [1] and [2]
+
   /*! \var graphsProducts_canBeFiniteCovolume(vector< vector< GraphsProductSet
    * > >) Used in canBeFiniteCovolume and canBeFiniteCovolume_complete [0]
    * Euclidean products of codimension 0
@@ -227,8 +363,8 @@ public:
    * vector<unsigned int> >&) Coxeter matrix \param dimension(const unsigned
    * int &) Dimension
    *
-   * 	CoxIter does not verification on iMatrix. Especially, it is assumed that
-   * iMatrix is symmetric
+   * 	The graph is read with readGraphFromMatrix: if the matrix is not valid,
+   * the graph is empty and get_error() gives the reason.
    */
   CoxIter(const vector<vector<unsigned int>> &iMatrix,
           const unsigned int &dimension);
@@ -250,6 +386,22 @@ public:
    */
   bool bRunAllComputations();
 
+  /*!	\fn analyse
+   * 	\brief Do the computations asked and gather the results
+   *
+   * 	Nothing is written on the standard output (unless debug is set). The
+   * checks of the cocompactness and of the finite covolume have to be asked
+   * before the graphs products are computed (i.e. at the first call):
+   * otherwise, the answer is -1.
+   * 	Only the results of the computations asked are given, even if other ones
+   * were done by a previous call (the others are -2, or not computed).
+   *
+   * 	\param analyses(const CoxIter_Analyses&) The computations
+   * 	\param results(CoxIter_Results&) The results (by reference)
+   * 	\return True if success (otherwise, see get_error())
+   */
+  bool analyse(const CoxIter_Analyses &analyses, CoxIter_Results &results);
+
   /*!	\fn printCoxeterMatrix
    * 	\brief Print Coxeter matrix
    */
@@ -290,15 +442,28 @@ public:
    */
   void printEdgesVisitedMatrix();
 
-/*! \fn readGraphFromFile
- * 	\brief Read the graph from a file
- *
- * 	\param inputFilename(const string&) Path to the file
- * 	\return True if success
- */
-#ifndef _COMPILE_WITHOUT_REGEXP_
+  /*! \fn readGraphFromFile
+   * 	\brief Read the graph from a file
+   *
+   * 	\param inputFilename(const string&) Path to the file
+   * 	\return True if success
+   */
   bool readGraphFromFile(const string &inputFilename);
-#endif
+
+  /*! \fn readGraphFromMatrix
+   * 	\brief Read the graph from its Coxeter matrix
+   *
+   * 	The entries are the orders of the edges (0 for a bold edge, 1 for a
+   * dotted edge, 2 if there is no edge); the diagonal is not read. The
+   * dimension (see set_dimension) is kept.
+   *
+   * 	\param matrix(const vector< vector<unsigned int> >&) Coxeter matrix
+   * 	\param labels(const vector<string>&) Labels of the vertices (if empty:
+   * 1, 2, ...)
+   * 	\return True if success
+   */
+  bool readGraphFromMatrix(const vector<vector<unsigned int>> &matrix,
+                           const vector<string> &labels = vector<string>());
 
   /*!	\fn writeGraphToDraw
    * 	\brief Write the graph in a file for GraphViz
@@ -317,15 +482,90 @@ public:
    */
   bool writeGraph(const string &filename);
 
-/*!	\fn parseGraph
- * 	\brief Read and parse graph from stream
- *
- * 	\param streamIn(const ifstream&) Stream to the content (file or
- * std::cin) \return True if success
- */
-#ifndef _COMPILE_WITHOUT_REGEXP_
+  /*!	\fn parseGraph
+   * 	\brief Read and parse graph from stream
+   *
+   * 	The whole content is read at once and tokenized in place (no regular
+   * expression).
+   *
+   * 	\param streamIn(const ifstream&) Stream to the content (file or
+   * std::cin) \return True if success
+   */
   bool parseGraph(istream &streamIn);
-#endif
+
+  /*!	\fn parseBinaryGraph
+   * 	\brief Read a graph written in the binary format (see writeBinaryGraph)
+   *
+   * 	The content can be a memory-mapped file: only the labels and the
+   * weights of the dotted edges are copied.
+   *
+   * 	\param data(const char*) Content
+   * 	\param size(const size_t&) Size of the content (in bytes)
+   * 	\return True if success
+   */
+  bool parseBinaryGraph(const char *data, const size_t &size);
+
+  /*!	\fn parseBinaryGraph
+   * 	\brief Read a graph written in the binary format, followed by other data
+   * (for example other graphs)
+   *
+   * 	\param data(const char*) Content
+   * 	\param size(const size_t&) Size of the content (in bytes)
+   * 	\param recordSize(size_t&) Size of the graph, in bytes (if success)
+   * 	\return True if success
+   */
+  bool parseBinaryGraph(const char *data, const size_t &size,
+                        size_t &recordSize);
+
+  /*!	\fn binaryGraphSize
+   * 	\brief Size of the graph written in the binary format at the beginning
+   * of data, without reading it (used to split concatenated graphs)
+   *
+   * 	\param data(const char*) Content
+   * 	\param size(const size_t&) Size of the content (in bytes)
+   * 	\return Size of the graph, in bytes (0 if the content is invalid)
+   */
+  static size_t binaryGraphSize(const char *data, const size_t &size);
+
+  /*!	\fn parseBinaryGraph
+   * 	\brief Read a graph written in the binary format from a stream
+   *
+   * 	\param streamIn(istream &) Stream to the content (file or std::cin)
+   * 	\return True if success
+   */
+  bool parseBinaryGraph(istream &streamIn);
+
+  /*! \fn readGraphFromBinaryFile
+   * 	\brief Read the graph from a file written in the binary format
+   *
+   * 	\param inputFilename(const string&) Path to the file
+   * 	\return True if success
+   */
+  bool readGraphFromBinaryFile(const string &inputFilename);
+
+  /*! 	\fn writeBinaryGraph
+   *	\brief Write the graph in the binary format
+   *
+   *	All the integers are unsigned, on 32 bits and little-endian (except
+   * the orders) and each block begins at a multiple of 4 bytes:
+   *	- header: "COXB", version, number of vertices, dimension (or 0), size of
+   * the orders (1, 2 or 4 bytes), size of the labels, number of weights
+   *	- orders of the upper triangular part, row by row (0: bold, 1: dotted)
+   *	- labels, each one followed by '\0'
+   *	- weights of the dotted edges: row, column, length, string
+   *
+   *	\param streamOut(ostream &) Stream
+   * 	\return True if success, false otherwise
+   */
+  bool writeBinaryGraph(ostream &streamOut);
+
+  /*! 	\fn writeBinaryGraph
+   *	\brief Write the graph in the file outFilenameBasis + ".coxiterb"
+   *
+   *	\param outFilenameBasis(const string &) Filename
+   * 	\return True if success, false otherwise
+   */
+  bool writeBinaryGraph(const string &outFilenameBasis);
 
   /*!
    * 	\fn exploreGraph
@@ -342,10 +582,19 @@ public:
    * 	Remark: It is suppose that both t0, s0 are admissible vertices whose
    * corresponding hyperplanes are (ultra)parallel
    *
+   * 	By default, only the products needed for the f-vector of the infinite
+   * sequence are enumerated (the graphs products are not computed). If
+   * withGraphsProducts is true and the products are not yet computed, both
+   * are done in the same enumeration (the symmetries are then not used, since
+   * t0 and s0 are usually not invariant).
+   * 	The dimension must be known.
+   *
    * \param t0(const string&) t0 Reflecting hyperplane
    * \param t0(const string&) s0 Other hyperplane
+   * \param withGraphsProducts(const bool&) Compute also the graphs products
    */
-  void IS_computations(const string &t0, const string &s0);
+  void IS_computations(const string &t0, const string &s0,
+                       const bool &withGraphsProducts = false);
 
   /*!	\fn computeEulerCharacteristicFVector
    * 	\brief Conmpute the euler characteristic and f-vector
@@ -361,6 +610,30 @@ public:
    */
   void growthSeries();
 
+  /*!	\fn growthRate_compare
+   * 	\brief Compare the growth rate with some threshold
+   *
+   * 	The growth series is not computed: the sign of 1/f(x) (where f is the
+   * growth series) is studied via the Steinberg formula on ]0, 1/threshold].
+   * 	\param threshold(const mpq_class &) Threshold
+   * 	\return 1 if growth rate >= threshold, 0 if growth rate < threshold,
+   * -1 if we cannot decide
+   */
+  int growthRate_compare(const mpq_class &threshold);
+
+  /*!	\fn growthRate_bounds
+   * 	\brief Find an interval which contains the growth rate
+   *
+   * 	As growthRate_compare, this does not compute the growth series. The
+   * interval is found by bisection on the sign changes of 1/f(x).
+   * 	\param lower(mpq_class &) Lower bound (by reference)
+   * 	\param upper(mpq_class &) Upper bound (by reference)
+   * 	\param iterations(const unsigned int &) Number of bisection steps
+   * 	\return True if success
+   */
+  bool growthRate_bounds(mpq_class &lower, mpq_class &upper,
+                         const unsigned int &iterations = 64);
+
   /*!	\fn isGraphCocompact
    * 	\brief Check whether the graph is cocompact or not
    * 	Remark: If the programm was not called with the -compacity flag, the
@@ -368,6 +641,29 @@ public:
    */
   int isGraphCocompact();
 
+  /*!	\fn computeCyclicProducts
+   * 	\brief Compute the cyclic products of the fundamental cycles of a
+   * spanning forest and the fields generated by the entries of the Gram matrix
+   * and by the cyclic products
+   *
+   * 	The dotted edges are not used: the cycles which contain one are not
+   * determined by the Coxeter matrix. The result is kept until the Coxeter
+   * matrix changes
+   */
+  void computeCyclicProducts();
+
+  /*!	\fn gramMatrixSignature
+   * 	\brief Signature of a Galois conjugate of the Gram matrix (numerically)
+   *
+   * 	The conjugate is obtained by replacing cos(pi/m) by cos(k * pi/m) for
+   * every weight. The graph cannot contain dotted edges.
+   *
+   * 	\param galoisConjugate(const unsigned int&) k
+   * 	\return Numbers of positive, negative and null eigenvalues
+   */
+  array<unsigned int, 3>
+  gramMatrixSignature(const unsigned int &galoisConjugate = 1) const;
+
   /*!	\fn isFiniteCovolume
    * 	\brief Check whether the graph is of finite covolume or not
    * 	Remark: If the programm was not called with the -fv flag, the function
@@ -400,6 +696,68 @@ public:
    */
   void computeGraphsProducts();
 
+  /*!
+   * \fn removeVertices
+   * \brief Analysis of the graph without some vertices
+   *
+   * 	The connected subgraphs and the products of graphs of the current
+   * graph (computed if needed) are filtered instead of exploring the new graph:
+   * only the products which contain a removed vertex are enumerated again. The
+   * results are the same as for the graph read with set_verticesToRemove.
+   *
+   * 	\param verticesLabels(const vector< string >&) Labels of the vertices to
+   * remove
+   * 	\param ci(CoxIter&) The new graph (which must be another instance)
+   * 	\return True if success (otherwise, see get_error)
+   */
+  bool removeVertices(const vector<string> &verticesLabels, CoxIter &ci);
+
+  /*!
+   * \fn addVertex
+   * \brief Add a vertex to the graph
+   *
+   * 	If the products of graphs were computed, the connected subgraphs are
+   * found again but only the products which contain the new vertex are
+   * enumerated. The results are the same as for the whole graph read from a
+   * file.
+   *
+   * 	\param orders(const vector< unsigned int >&) Orders of the edges between
+   * the vertices of the graph and the new vertex (0 for a bold line, 1 for a
+   * dotted line)
+   * 	\param label(const string&) Label of the new vertex (if empty: its
+   * number)
+   * 	\return True if success (otherwise, see get_error)
+   */
+  bool addVertex(const vector<unsigned int> &orders, const string &label = "");
+
+  /*!
+   * \fn sweepEdgesOrders
+   * \brief Compute the invariants of the group for several orders of some
+   * edges
+   *
+   * 	The graph without a vertex cover of the variable edges is explored
+   * once; for each assignment, these vertices are then added with addVertex
+   * (in parallel if OpenMP is used). The Euler characteristic, the f-vector,
+   * the cocompacity and the finite covolume (if the checks are enabled) and
+   * the growth series (if asked) are computed.
+   *
+   * 	\param edges(const vector< pair<string, string> >&) Variable edges (labels
+   * of the endpoints)
+   * 	\param orders(const vector< vector< unsigned int > >&) Candidate orders
+   * for each edge (0 for a bold line, 1 for a dotted line)
+   * 	\param assignments(vector< vector< unsigned int > >&) All the choices of
+   * orders (one order per edge), in lexicographic order
+   * 	\param results(vector< CoxIter_Results >&) The invariants for each
+   * assignment
+   * 	\param computeGrowthSeries(const bool&) If the growth series is computed
+   * 	\return True if success (otherwise, see get_error)
+   */
+  bool sweepEdgesOrders(const vector<pair<string, string>> &edges,
+                        const vector<vector<unsigned int>> &orders,
+                        vector<vector<unsigned int>> &assignments,
+                        vector<CoxIter_Results> &results,
+                        const bool &computeGrowthSeries = false);
+
   /*!
    * \fn printGrowthSeries
    * \brief Display the growth series
@@ -481,6 +839,101 @@ public:
    */
   vector<unsigned int> get_fVector() const;
 
+  /*! \fn get_stats
+   * 	\brief Return the timers and counters of the computations on the current
+   * graph (and the peak memory of the process)
+   * 	\return Statistics
+   */
+  CoxIter_Stats get_stats() const;
+
+  /*! \fn get_results
+   * 	\brief Return the invariants computed so far
+   *
+   * 	Remark: isEulerCharacteristicComputed is not set since CoxIter does not
+   * know if computeEulerCharacteristicFVector succeeded
+   * 	\return The invariants
+   */
+  CoxIter_Results get_results() const;
+
+  /*! \fn set_results
+   * 	\brief Set the invariants (e.g. taken from a cache) of the current graph
+   * instead of computing them
+   * 	\param results(const CoxIter_Results&) The invariants
+   */
+  void set_results(const CoxIter_Results &results);
+
+  /*! \fn get_canonicalForm
+   * 	\brief Canonical form of the graph
+   *
+   * 	Two graphs have the same canonical form if and only if they are
+   * isomorphic (with the same dimension and the same weights on the dotted
+   * edges). The vertices are ordered by refinement of the partition by the
+   * edges (with backtracking for the ties); the canonical form is the
+   * smallest upper triangular part of the matrix obtained so.
+   *
+   * 	\return Canonical form (string)
+   */
+  string get_canonicalForm() const;
+
+  /*! \fn get_canonicalForm
+   * 	\brief Canonical form of the graph and canonical labeling of the vertices
+   * 	\param labeling(vector<unsigned int>&) For each position in the canonical
+   * form, the index of the vertex
+   * 	\return Canonical form (string)
+   */
+  string get_canonicalForm(vector<unsigned int> &labeling) const;
+
+  /*! \fn get_canonicalLabeling
+   * 	\brief Canonical labeling of the vertices
+   *
+   * 	The labeling is unique up to an automorphism of the graph.
+   *
+   * 	\return For each position in the canonical form, the index of the vertex
+   */
+  vector<unsigned int> get_canonicalLabeling() const;
+
+  /*! \fn get_canonicalHash
+   * 	\brief Hash of the canonical form (see canonicalHash)
+   * 	\return Hash (64 bits)
+   */
+  uint64_t get_canonicalHash() const;
+
+  /*! \fn canonicalHash
+   * 	\brief Hash (FNV-1a, 64 bits) of a canonical form
+   * 	\param canonicalForm(const string&) Canonical form (see
+   * get_canonicalForm)
+   * 	\return Hash (64 bits)
+   */
+  static uint64_t canonicalHash(const string &canonicalForm);
+
+  /*! \fn isIsomorphicTo
+   * 	\brief Test if two graphs are isomorphic (the orders and the weights of
+   * the dotted edges are respected; the dimensions are not compared)
+   *
+   * 	\param graph(const CoxIter&) The other graph
+   * 	\return True if the graphs are isomorphic
+   */
+  bool isIsomorphicTo(const CoxIter &graph) const;
+
+  /*! \fn isIsomorphicTo
+   * 	\brief Test if two graphs are isomorphic and give an isomorphism
+   *
+   * 	\param graph(const CoxIter&) The other graph
+   * 	\param isomorphism(vector<unsigned int>&) If the graphs are isomorphic:
+   * for each vertex, the index of its image in graph
+   * 	\return True if the graphs are isomorphic
+   */
+  bool isIsomorphicTo(const CoxIter &graph,
+                      vector<unsigned int> &isomorphism) const;
+
+  /*! \fn get_automorphismsGenerators
+   * 	\brief Generators of the automorphism group of the graph (the orders and
+   * the weights of the dotted edges are respected)
+   * 	\return For each generator, the image of each vertex (empty if the group
+   * is trivial)
+   */
+  vector<vector<unsigned int>> get_automorphismsGenerators() const;
+
   /*! \fn get_infSeqFVectorsUnits
    * 	\brief Return the units of the f-vector after n-doubling
    * 	\return Units
@@ -512,6 +965,13 @@ public:
    */
   bool get_bWriteInfo() const;
 
+  /*!
+   * 	\fn get_output
+   * 	\brief Return the stream where the instance writes
+   * 	\return The stream
+   */
+  ostream &get_output() const;
+
   /*!
    * 	\fn get_debug
    * 	\brief Return get_debug
@@ -519,6 +979,33 @@ public:
    */
   bool get_debug() const;
 
+  /*!
+   * 	\fn get_useOpenMP
+   * 	\brief Return true if OpenMP is used
+   * 	\return useOpenMP
+   */
+  bool get_useOpenMP() const;
+
+  /*!
+   * 	\fn get_useSymmetries
+   * 	\brief Return true if the products are enumerated up to the
+   * automorphisms of the graph
+   * 	\return useSymmetries
+   */
+  bool get_useSymmetries() const;
+
+  /*!
+   * 	\fn get_memoryBounded
+   * 	\return memoryBounded (see set_memoryBounded)
+   */
+  bool get_memoryBounded() const;
+
+  /*!
+   * 	\fn get_streamedCheck
+   * 	\return streamedCheck (see set_streamedCheck)
+   */
+  bool get_streamedCheck() const;
+
   /*!
    * 	\fn get_dimension
    * 	\brief Return the dimension
@@ -632,6 +1119,18 @@ public:
    */
   string get_gramMatrixField() const;
 
+  /*!	\fn get_cyclicProducts
+   * 	\brief Cyclic products of the fundamental cycles (see
+   * computeCyclicProducts) \return Cyclic products (vector<CyclicProduct>)
+   */
+  vector<CyclicProduct> get_cyclicProducts() const;
+
+  /*!	\fn get_cyclicProductsField
+   * 	\brief Field generated by the cyclic products (see computeCyclicProducts)
+   * 	\return Field ("" if unknown)
+   */
+  string get_cyclicProductsField() const;
+
   /*!	\fn get_verticesCount
    * 	\brief Retourne le nombre de sommets du graphe
    * 	\return Retourne le nombre de sommets du graphe (int)
@@ -668,8 +1167,45 @@ public:
   void set_checkCofiniteness(const bool &value);
   void set_debug(const bool &value);
   void set_useOpenMP(const bool &value);
+
+  /*!
+   * 	\fn set_useSymmetries
+   * 	\brief Enumerate the graphs products up to the automorphisms of the graph
+   *
+   * 	Only one connected graph per orbit starts the products and the counts are
+   * weighted by the sizes of the orbits. The results are the same but the
+   * enumeration is shorter if the graph has many automorphisms.
+   *
+   * 	\param value(const bool&) True to use the automorphisms
+   */
+  void set_useSymmetries(const bool &value);
+
+  /*!
+   * 	\fn set_memoryBounded
+   * 	\brief Store the products used by the cocompactness and finite covolume
+   * tests as sorted ids of graphs, in one array per list
+   *
+   * 	The results are the same. The symmetries are then not used for the
+   * enumeration of the products and get_ptr_graphsProducts gives empty lists.
+   *
+   * 	\param value(const bool&) True for the memory-bounded mode
+   */
+  void set_memoryBounded(const bool &value);
+
+  /*!
+   * 	\fn set_streamedCheck
+   * 	\brief Memory-bounded mode in which the products of codimension 0 are
+   * not kept
+   *
+   * 	Each product of codimension 0 is compared to its subproducts of
+   * codimension 1 as soon as it is found; only the number of extensions of
+   * each product of codimension 1 is kept. If the dimension is not specified,
+   * the memory-bounded mode is used instead (see set_memoryBounded).
+   *
+   * 	\param value(const bool&) True for the streamed check
+   */
+  void set_streamedCheck(const bool &value);
   void set_outputFilename(const string &filename);
-  void set_sdtOutToFile(const string &filename);
   void set_verticesToRemove(const vector<string> &verticesRemove_);
   void set_verticesToConsider(const vector<string> &verticesToConsider);
 
@@ -681,6 +1217,16 @@ public:
    */
   void set_bWriteInfo(const bool &newValue);
 
+  /*!
+   * 	\fn set_output
+   * 	\brief Set the stream where the instance writes (instead of cout)
+   *
+   * 	The stream must exist as long as the instance writes in it. When OpenMP
+   * is used, the writes are done in critical sections.
+   * 	\param output(ostream&) The stream
+   */
+  void set_output(ostream &output);
+
   /*!
    * 	\fn set_dimension
    * 	\brief Update the member dimension
@@ -724,10 +1270,18 @@ public:
   /*!
    * 	\fn get_ptr_graphsProducts
    * 	\brief Return the list of graphs products
-   * 	Remark: there is absolutely no verification
+   * 	Remark: there is absolutely no verification (and the lists are empty
+   * in the memory-bounded mode)
    */
   const vector<vector<GraphsProductSet>> *get_ptr_graphsProducts() const;
 
+  /*!
+   * 	\fn get_graphsById
+   * 	\brief Return the connected graphs, by id (the products give the ids of
+   * their graphs, see GraphsProductSet)
+   */
+  const vector<Graph *> &get_graphsById() const;
+
   /*!
    * 	\fn set_coxeterMatrix
    * 	\brief Set the Coxeter matrix
@@ -735,6 +1289,28 @@ public:
    */
   void set_coxeterMatrix(const vector<vector<unsigned int>> &matrix);
 
+  /*!
+   * 	\fn set_coxeterMatrix_index2
+   * 	\brief Set the Coxeter matrix of the graph obtained by doubling the
+   * current graph along a vertex t0 (see Index2::removeVertex)
+   *
+   * 	The vertices of the new graph are the ones of the current graph except t0
+   * (same order) followed by the vertices t0 * s * t0, for s which do not
+   * commute with t0.
+   * 	If the graph was explored, the connected subgraphs of the new graph are
+   * derived from the ones of the current graph: the ones which do not contain
+   * t0, their images under t0 and the few ones which contain both s and
+   * t0 * s * t0. Hence, exploreGraph does not have to be called.
+   *
+   * 	\param matrix(const vector< vector<unsigned int> >&) The new matrix
+   * 	\param vertex(const unsigned int&) Index of t0 (in the current graph)
+   * 	\param originVertices(const vector< unsigned int >&) For each new vertex
+   * t0 * s * t0, the index of s (in the current graph)
+   */
+  void set_coxeterMatrix_index2(const vector<vector<unsigned int>> &matrix,
+                                const unsigned int &vertex,
+                                const vector<unsigned int> &originVertices);
+
   void set_ouputMathematicalFormat(const string &format);
 
   /*!
@@ -772,6 +1348,31 @@ private:
    */
   void initializations();
 
+  /*! 	\fn finalizeGraphReading
+   * 	\brief Once the Coxeter matrix and the labels are read: display some
+   * information and compute the cyclic products
+   */
+  void finalizeGraphReading();
+
+  /*! 	\fn resetGraph
+   * 	\brief Before reading a graph: forget the previous one and everything
+   * computed from it, so that the instance behaves as a new one (the options,
+   * the dimension and the vertices to remove are kept)
+   */
+  void resetGraph();
+
+  /*! 	\fn removeVertices_graph
+   * 	\brief Copy the graph without some vertices (the Coxeter matrix, the
+   * labels, the weights and the options) in another instance
+   * 	\param verticesIndices(const vector<int>&) New index of each vertex (-1
+   * if the vertex is removed)
+   * 	\param newVerticesCount(const unsigned int&) Number of vertices kept
+   * 	\param ci(CoxIter&) The new graph
+   */
+  void removeVertices_graph(const vector<int> &verticesIndices,
+                            const unsigned int &newVerticesCount,
+                            CoxIter &ci) const;
+
   /*! \fn DFS
    * \brief Look for all the An starting from a given vertex
    *
@@ -856,6 +1457,169 @@ private:
       const bool &isSpherical, GraphsProduct &gp,
       vector<bool> &gpNonLinkableVertices);
 
+  /*!	\fn computeGraphsProducts_addProduct
+   * 	\brief Add a product to the counts (and to the lists for the cocompacity
+   * and finite covolume tests)
+   *
+   * 	\param gp(GraphsProduct&) The product
+   * 	\param graphsProductsCount(vector< map<vector< vector<short unsigned
+   * int> >, unsigned int> >*) Counts of the products
+   * 	\param isSpherical(const bool&): True if spherical, false if euclidean
+   * 	\param weight(const unsigned int&) Number of times the product is counted
+   * 	\param orbitGraphsCount(const unsigned int&) With the symmetries: number
+   * of components in the orbit of the representative (0 otherwise)
+   */
+  void computeGraphsProducts_addProduct(
+      GraphsProduct &gp,
+      vector<map<vector<vector<short unsigned int>>, unsigned int>>
+          *graphsProductsCount,
+      const bool &isSpherical, const unsigned int &weight,
+      const unsigned int &orbitGraphsCount);
+
+  /*!	\fn computeGraphsIds
+   * 	\brief Give to each connected graph its id (see Graph::id)
+   *
+   * 	Called once the connected graphs are known (exploreGraph,
+   * removeVertices, set_coxeterMatrix_index2).
+   */
+  void computeGraphsIds();
+
+  /*!	\fn graphsProducts_add
+   * 	\brief Add a product to the list k of graphsProducts (or
+   * graphsProductsIds)
+   */
+  void graphsProducts_add(const unsigned int &k, const GraphsProduct &gp);
+
+  /*!	\fn graphsProducts_clear
+   * 	\brief Clear the list k of graphsProducts (or graphsProductsIds)
+   */
+  void graphsProducts_clear(const unsigned int &k);
+
+  /*!	\fn graphsProducts_shift
+   * 	\brief The products of codimension 0 ([1]) become the products of
+   * codimension 1 ([0]) (the dimension is guessed)
+   */
+  void graphsProducts_shift();
+
+  /*!	\fn graphsProducts_size
+   * 	\brief Number of products in the list k of graphsProducts
+   */
+  size_t graphsProducts_size(const unsigned int &k) const;
+
+  /*!	\fn graphsProducts_stream
+   * 	\brief Streamed check: count the extensions given by a product
+   *
+   * 	A spherical product of codimension 1 is extended by a product of
+   * codimension 0 if and only if its vertices are some of the vertices of
+   * the product. These are obtained by removing one vertex (spherical
+   * product) or one vertex of each component (euclidean product).
+   *
+   * 	\param gp(const GraphsProduct&) The product
+   * 	\param isSpherical(const bool&): True if spherical, false if euclidean
+   */
+  void graphsProducts_stream(const GraphsProduct &gp, const bool &isSpherical);
+
+  /*!	\fn computeGraphsProducts_representatives
+   * 	\brief Products of connected graphs, up to the automorphisms
+   *
+   * 	The orbits of the connected graphs are ordered and a product is
+   * enumerated only if it contains the representative of the first orbit of
+   * its components. It is counted with the size of this orbit, divided by the
+   * number of its components which are in this orbit (see
+   * symmetries_divideCounts).
+   *
+   * 	\param graphsList(GraphsList*) The connected graphs
+   * 	\param representatives(const vector<Graph*>&) One graph per orbit
+   * 	\param orbitsSizes(const vector<unsigned int>&) Sizes of the orbits
+   * 	\param graphsOrbits(const unordered_map<Graph*, unsigned int>&) Index
+   * of the orbit of each graph
+   * 	\param graphsProductsCount(vector< map<vector< vector<short unsigned
+   * int> >, unsigned int> >*) Counts of the products
+   * 	\param isSpherical(const bool&): True if spherical, false if euclidean
+   */
+  void computeGraphsProducts_representatives(
+      GraphsList *graphsList, const vector<Graph *> &representatives,
+      const vector<unsigned int> &orbitsSizes,
+      const unordered_map<Graph *, unsigned int> &graphsOrbits,
+      vector<map<vector<vector<short unsigned int>>, unsigned int>>
+          *graphsProductsCount,
+      const bool &isSpherical);
+
+  /*!	\fn computeGraphsProducts_symmetries
+   * 	\brief Same as computeGraphsProducts, for
+   * computeGraphsProducts_representatives
+   *
+   * 	\param orbit(const unsigned int&) Orbit of the representative (the
+   * graphs of the previous orbits are not taken)
+   * 	\param orbitSize(const unsigned int&) Size of this orbit
+   * 	\param orbitGraphsCount(const unsigned int&) Number of components of gp
+   * in this orbit
+   */
+  void computeGraphsProducts_symmetries(
+      GraphsListIterator grIt,
+      vector<map<vector<vector<short unsigned int>>, unsigned int>>
+          *graphsProductsCount,
+      const bool &isSpherical, GraphsProduct &gp,
+      vector<bool> &gpNonLinkableVertices,
+      const unordered_map<Graph *, unsigned int> &graphsOrbits,
+      const unsigned int &orbit, const unsigned int &orbitSize,
+      const unsigned int &orbitGraphsCount);
+
+  /*!	\fn symmetries_graphsOrbits
+   * 	\brief Orbits of the connected graphs under the automorphisms
+   *
+   * 	\param graphsList(GraphsList*) The connected graphs
+   * 	\param automorphisms(const vector<vector<unsigned int>>&) Generators
+   * 	\param representatives(vector<Graph*>&) One graph per orbit
+   * 	\param orbitsSizes(vector<unsigned int>&) Sizes of the orbits
+   * 	\param graphsOrbits(unordered_map<Graph*, unsigned int>&) Index of the
+   * orbit of each graph (the biggest orbits first)
+   * 	\param graphsByVertices(map<vector<short unsigned int>, Graph*>&) The
+   * graphs are added, by (sorted) vertices
+   * 	\return False if the image of a graph is not in the list
+   */
+  bool symmetries_graphsOrbits(
+      GraphsList *graphsList, const vector<vector<unsigned int>> &automorphisms,
+      vector<Graph *> &representatives, vector<unsigned int> &orbitsSizes,
+      unordered_map<Graph *, unsigned int> &graphsOrbits,
+      map<vector<short unsigned int>, Graph *> &graphsByVertices) const;
+
+  /*!	\fn symmetries_productsOrbits
+   * 	\brief Complete a list of products (one per orbit at least) with the
+   * images under the automorphisms, or keep one product per orbit
+   *
+   * 	\param products(vector<GraphsProductSet>&) The products
+   * 	\param automorphisms(const vector<vector<unsigned int>>&) Generators
+   * 	\param graphsByVertices(const map<vector<short unsigned int>, Graph*>&)
+   * Connected graphs, by (sorted) vertices
+   * 	\param isClosure(const bool&) If true, all the products of the orbits;
+   * otherwise, one product per orbit
+   */
+  void symmetries_productsOrbits(
+      vector<GraphsProductSet> &products,
+      const vector<vector<unsigned int>> &automorphisms,
+      const map<vector<short unsigned int>, Graph *> &graphsByVertices,
+      const bool &isClosure) const;
+
+  /*!	\fn symmetries_divideCounts
+   * 	\brief Divide the counts of computeGraphsProducts_representatives by the
+   * number of components in the first orbit (last element of the keys)
+   *
+   * 	\param graphsProductsCount(vector< map<vector< vector<short unsigned
+   * int> >, unsigned int> >&) Counts of the products
+   */
+  static void symmetries_divideCounts(
+      vector<map<vector<vector<short unsigned int>>, unsigned int>>
+          &graphsProductsCount);
+
+  /*!	\fn IS_addProduct
+   * 	\brief Add a product to the f-vector of the infinite sequence
+   *
+   * 	\param gp(const GraphsProduct&) The product
+   * 	\param isSpherical(const bool&): True if spherical, false if euclidean
+   */
+  void IS_addProduct(const GraphsProduct &gp, const bool &isSpherical);
+
   /*!	\fn computeGraphsProducts_IS(GraphsListIterator grIt, vector<
    * map<vector< vector<short unsigned int> >, unsigned int> >*
    * graphsProductsCount, const bool& isSpherical, GraphsProduct& gp, vector<
@@ -907,6 +1671,24 @@ private:
    */
   bool isGraph_cocompact_finiteVolume_sequential(unsigned int index);
 
+  /*!	\fn isGraph_cocompact_finiteVolume_ids
+   * 	\brief Same as isGraph_cocompact_finiteVolume_sequential, in the
+   * memory-bounded mode (the products [1] and [2] are not merged)
+   * 	\param index(unsigned int): 1 if test for compacity, 2 if test for the
+   * finite covolume
+   * 	\return True or false
+   */
+  bool isGraph_cocompact_finiteVolume_ids(unsigned int index);
+
+  /*!	\fn isGraph_cocompact_finiteVolume_streamed
+   * 	\brief Same as isGraph_cocompact_finiteVolume_sequential, for the
+   * streamed check (see graphsProductsExtensions)
+   * 	\param index(unsigned int): 1 if test for compacity, 2 if test for the
+   * finite covolume
+   * 	\return True or false
+   */
+  bool isGraph_cocompact_finiteVolume_streamed(unsigned int index);
+
   /*!	\fn growthSeries_symbolExponentFromProduct(const vector< vector<short
    * unsigned int> >& product, vector<unsigned int>& symbol, unsigned int&
    * exponent) const From a product of graphs, compute the corresponding symbol
@@ -947,6 +1729,50 @@ private:
 
   void growthSeries_details();
 
+  /*!	\fn growthSeries_inverseTerms
+   * 	\brief Terms of the Steinberg formula for 1/f(x) (f is the growth
+   * series)
+   *
+   * 	\param terms(vector< pair<long int, vector<unsigned int> > >&) For each
+   * product: its coefficient and its symbol (see
+   * growthSeries_symbolExponentFromProduct)
+   */
+  void growthSeries_inverseTerms(
+      vector<pair<long int, vector<unsigned int>>> &terms) const;
+
+  /*!	\fn growthSeries_inverseEvaluate
+   * 	\brief Evaluate 1/f(x) = (denominator + positive - negative) /
+   * denominator
+   *
+   * 	Both positive/denominator and negative/denominator are increasing
+   * functions of x.
+   * 	\param terms Terms computed by growthSeries_inverseTerms
+   * 	\param x(const mpq_class &) Point (>= 0)
+   * 	\param positive(mpz_class &) Sum of the positive terms (by reference)
+   * 	\param negative(mpz_class &) Sum of the negative terms (by reference)
+   * 	\param denominator(mpz_class &) Common denominator (by reference)
+   */
+  void growthSeries_inverseEvaluate(
+      const vector<pair<long int, vector<unsigned int>>> &terms,
+      const mpq_class &x, mpz_class &positive, mpz_class &negative,
+      mpz_class &denominator) const;
+
+  /*!	\fn growthSeries_inverseSign
+   * 	\brief Look for a point of ]a, b] where 1/f(x) <= 0
+   *
+   * 	\param terms Terms computed by growthSeries_inverseTerms
+   * 	\param a(const mpq_class &) Left endpoint (>= 0)
+   * 	\param b(const mpq_class &) Right endpoint
+   * 	\param x(mpq_class &) Such a point, if found (by reference)
+   * 	\param evaluationsMax(const unsigned int &) Maximal number of
+   * subdivisions of ]a, b]
+   * 	\return 1 if found, 0 if 1/f(x) > 0 on ]a, b], -1 if we cannot decide
+   */
+  int growthSeries_inverseSign(
+      const vector<pair<long int, vector<unsigned int>>> &terms,
+      const mpq_class &a, const mpq_class &b, mpq_class &x,
+      const unsigned int &evaluationsMax = 4096) const;
+
   /*!	\fn growthSeries_mergeTerms
    * 	Given the parameters, compute polynomial/symbol +=
    * tempPolynomial/tempSymbol
@@ -966,6 +1792,66 @@ private:
                                const vector<unsigned int> &tempSymbol,
                                mpz_class biTemp = 1);
 
+  /*!	\fn canonical_edgesCodes
+   * 	\brief Code the edges of the graph by small integers, for
+   * get_canonicalForm
+   *
+   * 	\param labels(vector<string>&) Labels of the edges (sorted): the code of
+   * an edge is the index of its label
+   * 	\return Matrix of the codes
+   */
+  vector<vector<unsigned int>>
+  canonical_edgesCodes(vector<string> &labels) const;
+
+  /*!	\fn canonical_refine
+   * 	\brief Refine the partition of the vertices (given by the colours) until
+   * it is equitable
+   *
+   * 	\param codes(const vector<vector<unsigned int>>&) Codes of the edges
+   * 	\param labelsCount(const unsigned int&) Number of codes
+   * 	\param colours(vector<unsigned int>&) Colours of the vertices (in: any
+   * values, out: 0, 1, ...)
+   */
+  void canonical_refine(const vector<vector<unsigned int>> &codes,
+                        const unsigned int &labelsCount,
+                        vector<unsigned int> &colours) const;
+
+  /*!	\fn canonical_compute
+   * 	\brief Canonical matrix and labeling (see get_canonicalForm)
+   *
+   * 	\param labels(vector<string>&) Labels of the edges (see
+   * canonical_edgesCodes)
+   * 	\param matrix(vector<unsigned int>&) Upper triangular part of the
+   * canonical matrix (codes of the edges)
+   * 	\param labeling(vector<unsigned int>&) For each position, the index of
+   * the vertex
+   */
+  void canonical_compute(vector<string> &labels, vector<unsigned int> &matrix,
+                         vector<unsigned int> &labeling) const;
+
+  /*!	\fn canonical_search
+   * 	\brief Backtracking for get_canonicalForm
+   *
+   * 	When two leaves give the same matrix, the corresponding automorphism is
+   * kept. Then, only one vertex per orbit (under the automorphisms which fix
+   * the individualized vertices) is individualized.
+   *
+   * 	\param codes(const vector<vector<unsigned int>>&) Codes of the edges
+   * 	\param labelsCount(const unsigned int&) Number of codes
+   * 	\param colours(vector<unsigned int>) Current partition
+   * 	\param path(vector<unsigned int>&) Individualized vertices
+   * 	\param best(vector<unsigned int>&) Smallest matrix found (empty at the
+   * beginning)
+   * 	\param bestLabeling(vector<unsigned int>&) Labeling giving best
+   * 	\param automorphisms(vector<vector<unsigned int>>&) Automorphisms found
+   */
+  void canonical_search(const vector<vector<unsigned int>> &codes,
+                        const unsigned int &labelsCount,
+                        vector<unsigned int> colours,
+                        vector<unsigned int> &path, vector<unsigned int> &best,
+                        vector<unsigned int> &bestLabeling,
+                        vector<vector<unsigned int>> &automorphisms) const;
+
 public:
   friend ostream &operator<<(ostream &, CoxIter const &);
 };
@@ -27,7 +27,7 @@ Graph::Graph(const vector<short unsigned int> &vertices,
              const vector<bool> &linkableVertices, const unsigned int &type,
              const bool &isSpherical, const unsigned int &dataSupp)
     : type(type), vertices(vertices), linkableVertices(linkableVertices),
-      dataSupp(dataSupp), isSpherical(isSpherical),
+      dataSupp(dataSupp), isSpherical(isSpherical), id(0),
       ptr_map_vertices_indexToLabel(ptr_map_vertices_indexToLabel),
       b_map_vertices_indexToLabelIsEmpty(
           !ptr_map_vertices_indexToLabel ||
@@ -52,6 +52,9 @@ public:
 
   bool isSpherical; ///< True if spherical, false if euclidean
 
+  unsigned int id; ///< Index among the connected graphs, increasing with
+                   ///< operator< (see CoxIter::computeGraphsIds)
+
 private:
   vector<string>
       *ptr_map_vertices_indexToLabel; ///< Pointeur vers la correspondance
@@ -63,6 +63,69 @@ void GraphsList::addGraph(const std::vector<short unsigned int> &vertices,
   }
 }
 
+void GraphsList::addGraph(const Graph &graph,
+                          const vector<short unsigned int> &verticesMap,
+                          const vector<bool> &linkableVertices) {
+  vector<short unsigned int> v; // Vertices, with the new indices
+  for (const auto &vertex : graph.vertices)
+    v.push_back(verticesMap[vertex]);
+
+  const size_t n(v.size());
+  vector<short unsigned int> path;
+  unsigned int vertexSupp1(0), vertexSupp2(0);
+
+  // Inverse of the encoding of GraphsListN::addGraph
+  if ((graph.type == 6 && graph.isSpherical) ||
+      (graph.type == 0 && !graph.isSpherical && !graph.dataSupp)) { // G2, TA1
+    path = v;
+    sort(path.begin(), path.end());
+  } else if (graph.type == 0 && graph.isSpherical) // An
+    path = v;
+  else if (!graph.isSpherical && graph.type == 1) {
+    if (n == 4) { // TB3
+      path.push_back(v[2]);
+      path.push_back(v[1]);
+      path.push_back(v[3]);
+      vertexSupp1 = v[0];
+    } else { // TBn
+      path = vector<short unsigned int>(v.begin() + 1, v.end() - 1);
+      vertexSupp1 = v[n - 1];
+      vertexSupp2 = v[0];
+    }
+  } else if (!graph.isSpherical && graph.type == 2) { // TCn
+    path = vector<short unsigned int>(v.begin() + 1, v.end() - 1);
+    vertexSupp1 = v[0];
+    vertexSupp2 = v[n - 1];
+  } else if (!graph.isSpherical && graph.type == 3) {
+    if (n == 5) { // TD4
+      path.push_back(v[0]);
+      path.push_back(v[4]);
+      path.push_back(v[1]);
+      vertexSupp1 = v[2];
+      vertexSupp2 = v[3];
+    } else { // TDn
+      path.push_back(v[0]);
+      path.insert(path.end(), v.begin() + 2, v.end() - 1);
+      vertexSupp1 = v[1];
+      vertexSupp2 = v[n - 1];
+    }
+  } else if (!graph.isSpherical && graph.type == 4 && n == 7) { // TE6
+    path.push_back(v[0]);
+    path.push_back(v[1]);
+    path.push_back(v[6]);
+    path.push_back(v[2]);
+    path.push_back(v[3]);
+    vertexSupp1 = v[4];
+    vertexSupp2 = v[5];
+  } else { // Bn, Dn, En, F4, Hn, TAn, TE7, TE8, TF4, TG2: path + one vertex
+    path = vector<short unsigned int>(v.begin(), v.end() - 1);
+    vertexSupp1 = v[n - 1];
+  }
+
+  addGraph(path, linkableVertices, graph.type, graph.isSpherical, vertexSupp1,
+           vertexSupp2, graph.dataSupp);
+}
+
 Graph *GraphsList::begin() {
   if (!totalGraphsCount)
     return 0;
@@ -91,6 +154,28 @@ Graph *GraphsList::next(size_t &verticesCount, size_t &graphIndex) {
   return 0;
 }
 
+void GraphsList::removeVertices(
+    const vector<int> &verticesIndices,
+    vector<string> *ptr_map_vertices_indexToLabel) {
+  size_t verticesCount(0);
+  for (const auto &index : verticesIndices) {
+    if (index >= 0)
+      verticesCount++;
+  }
+
+  // The graphs with more vertices contain a removed vertex
+  graphs.erase(graphs.begin() + verticesCount + 1, graphs.end());
+  graphsCount = vector<size_t>(verticesCount + 1, 0);
+  totalGraphsCount = 0;
+  maxVertices = verticesCount;
+
+  for (size_t i(0); i <= maxVertices; i++) {
+    graphs[i].removeVertices(verticesIndices, ptr_map_vertices_indexToLabel);
+    graphsCount[i] = graphs[i].size();
+    totalGraphsCount += graphsCount[i];
+  }
+}
+
 ostream &operator<<(ostream &o, const GraphsList &g) {
   for (const auto &graph : g.graphs)
     o << graph;
@@ -72,6 +72,24 @@ public:
                 const unsigned int &vertexSupp2 = 0,
                 const unsigned int &dataSupp = 0);
 
+  /*!
+   * 	\fn addGraph
+   * 	\brief Ajoute une copie d'un graphe, avec d'autres indices de sommets
+   *
+   * 	The graph is given back to addGraph in the same way as it was found
+   * (path and supplementary vertices), so that the vertices are ordered as if
+   * the graph was found by CoxIter::exploreGraph.
+   *
+   * 	\param graph(const Graph &): le graphe
+   * 	\param verticesMap(const vector< short unsigned int > &): new index of
+   * each vertex of the graph
+   * 	\param linkableVertices(const vector< bool > &): sommets qui sont
+   * liables (ou non) au graphe (new indices)
+   */
+  void addGraph(const Graph &graph,
+                const vector<short unsigned int> &verticesMap,
+                const vector<bool> &linkableVertices);
+
   /*!	\fn begin
    * 	\brief Retourne un pointeur sur le premier graphe de la liste
    *
@@ -91,6 +109,18 @@ public:
    */
   Graph *next(size_t &verticesCount, size_t &graphIndex);
 
+  /*!	\fn removeVertices
+   * 	\brief Remove the graphs which contain some vertices and renumber the
+   * vertices of the other graphs (see GraphsListN::removeVertices)
+   *
+   * 	\param verticesIndices(const vector<int>&) New index of each vertex (-1
+   * if the vertex is removed)
+   * 	\param ptr_map_vertices_indexToLabel(vector< string > *) Pointer to the
+   * new correspondence index --> label
+   */
+  void removeVertices(const vector<int> &verticesIndices,
+                      vector<string> *ptr_map_vertices_indexToLabel);
+
 public: // Remark: this is public for read-only purpose!
   vector<GraphsListN>
       graphs; ///< List of list of graphs (by number of vertices)
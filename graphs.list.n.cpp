@@ -29,6 +29,38 @@ GraphsListN::GraphsListN(unsigned int verticesCount,
 
 size_t GraphsListN::size() const { return graphs.size(); }
 
+void GraphsListN::removeVertices(
+    const vector<int> &verticesIndices,
+    vector<string> *ptr_map_vertices_indexToLabel) {
+  this->ptr_map_vertices_indexToLabel = ptr_map_vertices_indexToLabel;
+
+  vector<Graph> graphsKept;
+  for (const auto &graph : graphs) {
+    vector<short unsigned int> vertices;
+    for (const auto &vertex : graph.vertices) {
+      if (verticesIndices[vertex] < 0)
+        break;
+
+      vertices.push_back(verticesIndices[vertex]);
+    }
+
+    if (vertices.size() != graph.vertices.size()) // Contains a removed vertex
+      continue;
+
+    vector<bool> linkableVertices;
+    for (size_t i(0); i < verticesIndices.size(); i++) {
+      if (verticesIndices[i] >= 0)
+        linkableVertices.push_back(graph.linkableVertices[i]);
+    }
+
+    graphsKept.push_back(Graph(vertices, ptr_map_vertices_indexToLabel,
+                               linkableVertices, graph.type,
+                               graph.isSpherical, graph.dataSupp));
+  }
+
+  graphs = graphsKept;
+}
+
 Graph *GraphsListN::next(const size_t &graphIndex) {
   return &graphs[graphIndex];
 }
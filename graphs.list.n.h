@@ -76,6 +76,20 @@ public:
    */
   bool addGraphsList(const GraphsListN &gln);
 
+  /*!	\fn removeVertices
+   * 	\brief Remove the graphs which contain some vertices and renumber the
+   * vertices of the other graphs
+   *
+   * 	The order of the list is kept since the renumbering is increasing.
+   *
+   * 	\param verticesIndices(const vector<int>&) New index of each vertex (-1
+   * if the vertex is removed)
+   * 	\param ptr_map_vertices_indexToLabel(vector< string > *) Pointer to the
+   * new correspondence index --> label
+   */
+  void removeVertices(const vector<int> &verticesIndices,
+                      vector<string> *ptr_map_vertices_indexToLabel);
+
   /*! 	\fn size
    * 	\brief Retourne la taille de la liste de graphes
    * 	\return Taille de la liste de graphes (size_t)
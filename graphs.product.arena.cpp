@@ -0,0 +1,50 @@
+/*
+Copyright (C) 2013-2017
+Rafael Guglielmetti, rafael.guglielmetti@unifr.ch
+*/
+
+/*
+This file is part of CoxIter.
+
+CoxIter is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+CoxIter is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "graphs.product.arena.h"
+
+GraphsProductArena::GraphsProductArena() : offsets(1, 0) {}
+
+void GraphsProductArena::push_back(const GraphsProduct &gp) {
+  for (const auto &graph : gp.graphs)
+    ids.push_back(graph->id);
+
+  sort(ids.begin() + offsets.back(), ids.end());
+  offsets.push_back(ids.size());
+}
+
+void GraphsProductArena::clear() {
+  ids.clear();
+  offsets = vector<size_t>(1, 0);
+}
+
+size_t GraphsProductArena::size() const { return offsets.size() - 1; }
+
+bool GraphsProductArena::empty() const { return offsets.size() == 1; }
+
+const unsigned int *GraphsProductArena::begin(const size_t &i) const {
+  return ids.data() + offsets[i];
+}
+
+const unsigned int *GraphsProductArena::end(const size_t &i) const {
+  return ids.data() + offsets[i + 1];
+}
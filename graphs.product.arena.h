@@ -0,0 +1,76 @@
+/*
+Copyright (C) 2013-2017
+Rafael Guglielmetti, rafael.guglielmetti@unifr.ch
+*/
+
+/*
+This file is part of CoxIter.
+
+CoxIter is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+CoxIter is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GRAPHSPRODUCTARENA_H
+#define GRAPHSPRODUCTARENA_H
+
+/*!
+ * \file graphs.product.arena.h
+ * \author Rafael Guglielmetti
+ *
+ * \class GraphsProductArena
+ * \brief A list of graphs products, stored as sorted ids of graphs (see
+ * Graph::id) in one contiguous array
+ *
+ * Used instead of vector< GraphsProductSet > in the memory-bounded mode (see
+ * CoxIter::set_memoryBounded): a product costs its ids and one offset, instead
+ * of one node of a std::set per graph.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "graph.h"
+#include "graphs.product.h"
+
+using namespace std;
+
+class GraphsProductArena {
+private:
+  vector<unsigned int> ids; ///< Ids of the graphs, product after product
+  vector<size_t> offsets;   ///< Product i: ids[offsets[i]] to ids[offsets[i+1]]
+
+public:
+  GraphsProductArena();
+
+  /*!	\fn push_back
+   * 	\brief Add a product at the end of the list
+   * 	\param gp(const GraphsProduct&) The product
+   */
+  void push_back(const GraphsProduct &gp);
+
+  void clear();
+  size_t size() const;
+  bool empty() const;
+
+  /*!	\fn begin
+   * 	\brief First id of the product i (the ids are sorted)
+   */
+  const unsigned int *begin(const size_t &i) const;
+
+  /*!	\fn end
+   * 	\brief Past-the-end id of the product i
+   */
+  const unsigned int *end(const size_t &i) const;
+};
+
+#endif // GRAPHSPRODUCTARENA_H
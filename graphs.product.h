@@ -30,7 +30,7 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
  * Ces produits sont utilisés de manière volatile dans le programme. Les graphes
  * sont ajoutés dans le std::vector au fur et à mesure. Au contraire,
  * GraphsProductSet est utilisé pour garder les produits de manière persistante;
- * les graphes sont stockés dans un std::set
+ * les graphes sont stockés (triés, par leurs ids) dans un tableau
  */
 
 #ifndef GRAPHS_PRODUCT_H
@@ -22,38 +22,90 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include "graphs.product.set.h"
 
-GraphsProductSet::GraphsProductSet() : rank(0) {}
+GraphsProductSet::GraphsProductSet()
+    : rank(0), graphsCount(0), idsInline(), idsHeap(nullptr) {}
 
-GraphsProductSet::GraphsProductSet(const GraphsProduct &gp) {
-  rank = gp.rank;
+GraphsProductSet::GraphsProductSet(const GraphsProduct &gp)
+    : rank(gp.rank), graphsCount(gp.graphs.size()), idsInline(),
+      idsHeap(nullptr) {
+  if (graphsCount > inlineSize)
+    idsHeap = new unsigned int[graphsCount];
 
-  for (vector<Graph *>::const_iterator it(gp.graphs.begin());
-       it != gp.graphs.end(); ++it)
-    graphs.insert(*it);
+  unsigned int *ids(graphsCount > inlineSize ? idsHeap : idsInline);
+  for (unsigned int i(0); i < graphsCount; i++)
+    ids[i] = gp.graphs[i]->id;
+
+  sort(ids, ids + graphsCount);
+}
+
+GraphsProductSet::GraphsProductSet(const unsigned int &rank,
+                                   vector<unsigned int> ids)
+    : rank(rank), graphsCount(ids.size()), idsInline(), idsHeap(nullptr) {
+  sort(ids.begin(), ids.end());
+
+  if (graphsCount > inlineSize)
+    idsHeap = new unsigned int[graphsCount];
+
+  copy(ids.begin(), ids.end(), graphsCount > inlineSize ? idsHeap : idsInline);
 }
 
-vector<short unsigned int> GraphsProductSet::get_vertices() const {
+GraphsProductSet::GraphsProductSet(const GraphsProductSet &gp)
+    : rank(gp.rank), graphsCount(gp.graphsCount), idsInline(),
+      idsHeap(nullptr) {
+  if (graphsCount > inlineSize)
+    idsHeap = new unsigned int[graphsCount];
+
+  copy(gp.begin(), gp.end(), graphsCount > inlineSize ? idsHeap : idsInline);
+}
+
+GraphsProductSet::GraphsProductSet(GraphsProductSet &&gp) noexcept
+    : rank(0), graphsCount(0), idsInline(), idsHeap(nullptr) {
+  swap(gp);
+}
+
+GraphsProductSet::~GraphsProductSet() { delete[] idsHeap; }
+
+GraphsProductSet &GraphsProductSet::operator=(GraphsProductSet gp) {
+  swap(gp);
+  return *this;
+}
+
+void GraphsProductSet::swap(GraphsProductSet &gp) {
+  std::swap(rank, gp.rank);
+  std::swap(graphsCount, gp.graphsCount);
+  std::swap(idsInline, gp.idsInline);
+  std::swap(idsHeap, gp.idsHeap);
+}
+
+const unsigned int *GraphsProductSet::begin() const {
+  return graphsCount > inlineSize ? idsHeap : idsInline;
+}
+
+const unsigned int *GraphsProductSet::end() const {
+  return begin() + graphsCount;
+}
+
+size_t GraphsProductSet::size() const { return graphsCount; }
+
+vector<short unsigned int>
+GraphsProductSet::get_vertices(const vector<Graph *> &graphsById) const {
   vector<short unsigned int> vertices;
 
-  for (set<Graph *>::const_iterator itProd(graphs.begin());
-       itProd != graphs.end(); ++itProd) {
-    for (vector<short unsigned int>::const_iterator itV(
-             (*itProd)->vertices.begin());
-         itV != (*itProd)->vertices.end(); ++itV) {
-      vertices.push_back(*itV);
-    }
-  }
+  for (const auto &id : *this)
+    vertices.insert(vertices.end(), graphsById[id]->vertices.begin(),
+                    graphsById[id]->vertices.end());
 
   return vertices;
 }
 
-bool GraphsProductSet::areVerticesSubsetOf(const GraphsProductSet &gp) const {
+bool GraphsProductSet::areVerticesSubsetOf(
+    const GraphsProductSet &gp, const vector<Graph *> &graphsById) const {
   /* NOTE:
    * We could sort de vectors and use the standard function includes but this is
    * slower (tested with 17-vinb85).
    */
-  vector<short unsigned int> verticesSmall(get_vertices()),
-      verticesBig(gp.get_vertices());
+  vector<short unsigned int> verticesSmall(get_vertices(graphsById)),
+      verticesBig(gp.get_vertices(graphsById));
 
   for (vector<short unsigned int>::const_iterator it(verticesSmall.begin());
        it != verticesSmall.end(); ++it) {
@@ -64,10 +116,10 @@ bool GraphsProductSet::areVerticesSubsetOf(const GraphsProductSet &gp) const {
   return true;
 }
 
-ostream &operator<<(ostream &o, const GraphsProductSet &gp) {
-  for (set<Graph *>::const_iterator it(gp.graphs.begin());
-       it != gp.graphs.end(); ++it)
-    o << **it;
+ostream &GraphsProductSet::print(ostream &o,
+                                 const vector<Graph *> &graphsById) const {
+  for (const auto &id : *this)
+    o << *graphsById[id];
 
   return o;
 }
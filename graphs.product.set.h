@@ -30,12 +30,16 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
  * \class GraphsProduct
  * \brief: Un produit de graphess
  *
- * Ces produits sont utilisés pour tester la compacité
+ * Ces produits sont utilisés pour tester la compacité. Les graphes sont
+ * donnés par leurs ids (voir Graph::id), triés: les différences et les
+ * inclusions se calculent sur des entiers. Jusqu'à inlineSize graphes, les
+ * ids sont gardés dans l'objet (pas d'allocation).
  */
 
+#include <algorithm>
 #include <iterator>
-#include <set>
 #include <string>
+#include <vector>
 
 #include "graph.h"
 #include "graphs.product.h"
@@ -45,28 +49,74 @@ using namespace std;
 class GraphsProductSet {
 public:
   unsigned int rank; ///< Rank of the graph
-  set<Graph *, GraphPtrComp>
-      graphs; ///< Pointeurs vers les graphes qui constituent le produit
+
+private:
+  static const unsigned int inlineSize = 8; ///< Ids kept in the object
+
+  unsigned int graphsCount; ///< Number of graphs of the product
+  unsigned int idsInline[inlineSize]; ///< Sorted ids (at most inlineSize)
+  unsigned int *idsHeap; ///< Sorted ids (more than inlineSize graphs)
 
 public:
   GraphsProductSet();
   GraphsProductSet(const GraphsProduct &gp);
 
-  /*!	\fn getvces
+  /*!	\fn GraphsProductSet
+   * 	\brief Constructor
+   * 	\param rank(const unsigned int&) Rank of the product
+   * 	\param ids(vector< unsigned int >) Ids of the graphs (in any order)
+   */
+  GraphsProductSet(const unsigned int &rank, vector<unsigned int> ids);
+
+  GraphsProductSet(const GraphsProductSet &gp);
+  GraphsProductSet(GraphsProductSet &&gp) noexcept;
+  ~GraphsProductSet();
+
+  GraphsProductSet &operator=(GraphsProductSet gp);
+
+  /*!	\fn begin
+   * 	\brief First id (the ids are sorted)
+   */
+  const unsigned int *begin() const;
+
+  /*!	\fn end
+   * 	\brief Past-the-end id
+   */
+  const unsigned int *end() const;
+
+  /*!	\fn size
+   * 	\brief Number of graphs
+   */
+  size_t size() const;
+
+  /*!	\fn get_vertices
    * 	\brief Get the list of vertices of the product
    *
+   * 	\param graphsById(const vector< Graph* >&) Graphs, by id
    * 	\return vertices(vector< unsigned int >)
    */
-  vector<short unsigned int> get_vertices() const;
+  vector<short unsigned int>
+  get_vertices(const vector<Graph *> &graphsById) const;
 
   /*!	\fn areVerticesSubsetOf
    * 	\brief Test if the vertices appear in another Product
    * 	\param gp(const GraphsProductSet&): The other product
+   * 	\param graphsById(const vector< Graph* >&) Graphs, by id
    * 	\return Bool
    */
-  bool areVerticesSubsetOf(const GraphsProductSet &gp) const;
+  bool areVerticesSubsetOf(const GraphsProductSet &gp,
+                           const vector<Graph *> &graphsById) const;
+
+  /*!	\fn print
+   * 	\brief Display the graphs of the product
+   * 	\param o(ostream&) The stream
+   * 	\param graphsById(const vector< Graph* >&) Graphs, by id
+   * 	\return The stream
+   */
+  ostream &print(ostream &o, const vector<Graph *> &graphsById) const;
 
-  friend ostream &operator<<(ostream &o, const GraphsProductSet &gp);
+private:
+  void swap(GraphsProductSet &gp);
 };
 
 #endif // GRAPHSPRODUCTSET_H
@@ -22,29 +22,56 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include "growthrate.h"
 
-GrowthRate::GrowthRate() {
-  pari_init(50000000, 2);
+GrowthRate::GrowthRate(const unsigned int &precision)
+    : gIsolatingInterval(NULL) {
+  pariInit();
+  avStart = avma;
+
+  lastResult.isComputed = false;
+  set_precision(precision);
+}
+
+GrowthRate::~GrowthRate() { pariClose(); }
+
+void GrowthRate::set_precision(const unsigned int &precision) {
+  if (!precision)
+    throw(string("GrowthRate::set_precision: The precision must be positive"));
+
+  this->precision = precision;
 
   /* Note: gEpsilon must be BIG compared to the precision up to which we compute
    * the roots (so that we can detect when a root is too small).
+   * The roots are computed with three times the number of digits displayed.
+   * For 38 digits, this gives prec = 8 and gEpsilon = 10^-50.
    * */
-  gEpsilon = dbltor(1e-50);
-  pariPrecision = 8;
+  pariPrecision = ndec2prec(3 * precision);
+  gEpsilon =
+      gtofp(gpowgs(stoi(10), -(long)(4 * precision) / 3), pariPrecision);
 
   // The following two lines are useless except with the test program.
 
   long prec;
-  setrealprecision(38, &prec);
+  setrealprecision(precision, &prec);
 }
 
-GrowthRate::~GrowthRate() { pari_close(); }
+unsigned int GrowthRate::get_precision() const { return precision; }
 
 GrowthRate_Result GrowthRate::grrComputations(vector<mpz_class> polynomial,
                                               const bool &onlyGrowthRate) {
+  // The data of the previous computation is dropped (gEpsilon is allocated
+  // again)
+  avma = avStart;
+  set_precision(precision);
+
+  t_POLfactors.clear();
+  gIsolatingInterval = NULL;
+  lastResult.isComputed = false;
+
   irreducibleFactors(polynomial);
   gGrowthRate = dbltor(
       1.0); // Have to allocate the memory for this outside of some functions
   minimalRoot();
+  isolateMaximalRoot();
 
   // ----------------------------------------------------------
   pari_sp av = avma; // current state of the PARI stack
@@ -64,6 +91,7 @@ GrowthRate_Result GrowthRate::grrComputations(vector<mpz_class> polynomial,
   if (onlyGrowthRate) {
     avma = av; // cleaning the stack
     grr.isComputed = true;
+    lastResult = grr;
     return grr;
   }
 
@@ -116,14 +144,8 @@ GrowthRate_Result GrowthRate::grrComputations(vector<mpz_class> polynomial,
       if (mpcmp(gadd(gTemp, gEpsilon), gGrowthRateSquared) >= 0) {
         if (mpcmp(gsub(gTemp, gEpsilon), gGrowthRateSquared) >= 0)
           grr.perron = -1; // We cannot decide
-        else {
-          cout << "Growth rate=";
-          output(gGrowthRate);
-          cout << endl;
-          cout << "Current tested root=";
-          output(gRoot);
+        else
           grr.perron = 0; // Not Perron
-        }
       }
     } else // The root is real
     {
@@ -135,14 +157,8 @@ GrowthRate_Result GrowthRate::grrComputations(vector<mpz_class> polynomial,
         if (mpcmp(gadd(greal(gRoot), gEpsilon), gGrowthRate) >= 0) {
           if (mpcmp(gsub(greal(gRoot), gEpsilon), gGrowthRate) < 0)
             grr.perron = -1; // We cannot decide
-          else {
-            cout << "Growth rate=";
-            output(gGrowthRate);
-            cout << endl;
-            cout << "Current tested root=";
-            output(gRoot);
+          else
             grr.perron = 0; // Not Perron
-          }
         }
       }
       // If positive, nothing to do since we selected the smallest positive root
@@ -187,9 +203,56 @@ GrowthRate_Result GrowthRate::grrComputations(vector<mpz_class> polynomial,
   // ----------------------------------------------------------
   avma = av; // cleaning the stack
   grr.isComputed = true;
+  lastResult = grr;
   return grr;
 }
 
+GrowthRate_Result GrowthRate::refine(const unsigned int &precision) {
+  if (!lastResult.isComputed)
+    throw(string("GrowthRate::refine: The growth rate was not computed"));
+
+  if (!gIsolatingInterval)
+    throw(string("GrowthRate::refine: The growth rate could not be isolated"));
+
+  set_precision(precision);
+
+  pari_sp ltop = avma;
+
+  GEN f(t_POLfactors[indexMaximalRoot]);
+  GEN gA(gel(gIsolatingInterval, 1)), gB(gel(gIsolatingInterval, 2));
+  GEN gWidth(gpowgs(stoi(10), -(long)(4 * precision) / 3));
+  int signA(gsigne(poleval(f, gA)));
+
+  // Bisection: f has exactly one root in ]gA, gB[
+  while (gcmp(gsub(gB, gA), gWidth) > 0) {
+    GEN gMiddle(gmul2n(gadd(gA, gB), -1));
+    int signMiddle(gsigne(poleval(f, gMiddle)));
+
+    if (!signMiddle) // The growth rate is rational
+    {
+      gA = gMiddle;
+      gB = gMiddle;
+      break;
+    }
+
+    if (signMiddle == signA)
+      gA = gMiddle;
+    else
+      gB = gMiddle;
+
+    gerepileall(ltop, 3, &gA, &gB, &gWidth);
+  }
+
+  gIsolatingInterval = gerepilecopy(ltop, mkvec2(gA, gB));
+  gGrowthRate =
+      gtofp(gmul2n(gadd(gel(gIsolatingInterval, 1), gel(gIsolatingInterval, 2)),
+                   -1),
+            pariPrecision);
+
+  lastResult.growthRate = GENtostr(gGrowthRate);
+  return lastResult;
+}
+
 void GrowthRate::irreducibleFactors(const vector<mpz_class> &polynomial) {
   // ---------------------------------------------------
   // Factors
@@ -277,6 +340,27 @@ void GrowthRate::minimalRoot() {
   gerepileall(ltop, 2, &gMaximalRoots, &gGrowthRate);
 }
 
+void GrowthRate::isolateMaximalRoot() {
+  pari_sp ltop = avma;
+
+  GEN f(t_POLfactors[indexMaximalRoot]);
+
+  // gGrowthRate is known with an error much smaller than gEpsilon
+  GEN gScale(gpowgs(stoi(10), (long)(4 * precision) / 3));
+  GEN gFloor(gfloor(gmul(gGrowthRate, gScale)));
+  GEN gA(gdiv(gsubgs(gFloor, 1), gScale));
+  GEN gB(gdiv(gaddgs(gFloor, 2), gScale));
+
+  if (sturmpart(f, gA, gB) != 1) // Cannot refine safely
+  {
+    avma = ltop;
+    gIsolatingInterval = NULL;
+    return;
+  }
+
+  gIsolatingInterval = gerepilecopy(ltop, mkvec2(gA, gB));
+}
+
 long int GrowthRate::numberRootsUnitCircle(GEN gPol) {
   pari_sp ltop = avma;
   if (cmp_RgX(gPol, RgX_recip(gPol)) !=
@@ -63,16 +63,49 @@ private:
   GEN gMaximalRoots; ///< Roots of the polynomial which has the maximal root
   long int indexMaximalRoot; ///< Factor which contains the minimal root
 
+  GEN gIsolatingInterval; ///< [a, b] (exact rationals) which contains the
+                          ///< growth rate and no other root of the factor
+                          ///< (NULL if we could not isolate it)
+
   GEN gEpsilon;           ///< Some small number (typically 10^-50)
   long int pariPrecision; ///< Given as prec (typically 8)
+  unsigned int precision; ///< Number of significant digits of the result
+
+  GrowthRate_Result lastResult; ///< Result of the last computation
+
+  pari_sp avStart; ///< State of the PARI stack before the computations (the
+                   ///< stack is cleaned at each call to grrComputations)
 
 public:
-  GrowthRate();
+  /*!	\fn GrowthRate(const unsigned int &precision = 38)
+   * 	Constructor
+   * 	The instance can be used for several computations: the PARI stack is
+   * cleaned at the beginning of each one.
+   * 	\param precision Number of significant digits of the growth rate
+   */
+  GrowthRate(const unsigned int &precision = 38);
   ~GrowthRate();
 
   GrowthRate_Result grrComputations(vector<mpz_class> polynomial,
                                     const bool &onlyGrowthRate = false);
 
+  /*!	\fn refine(const unsigned int &precision)
+   * 	Compute the growth rate found by the last call to grrComputations
+   * with more digits. The root is refined by bisection on the irreducible
+   * factor which contains it, starting from the isolating interval of the
+   * previous call (hence the polynomial is neither factored nor solved again).
+   * 	\param precision Number of significant digits wanted
+   * 	\return The result of the last computation, with updated growthRate
+   */
+  GrowthRate_Result refine(const unsigned int &precision);
+
+  /*!	\fn set_precision(const unsigned int &precision)
+   * 	Set the number of significant digits used for the next computations
+   * 	\param precision Number of digits
+   */
+  void set_precision(const unsigned int &precision);
+  unsigned int get_precision() const;
+
 private:
   /*!	\fn irreducibleFactors(const vector< mpz_class >& polynomial)
    * 	Factor the polynomial polynomial and store the factors into
@@ -87,6 +120,13 @@ private:
    */
   void minimalRoot();
 
+  /*!	\fn isolateMaximalRoot()
+   * 	Find an interval with rational endpoints which contains the growth rate
+   * and no other root of t_POLfactors[indexMaximalRoot]; store it into
+   * gIsolatingInterval
+   */
+  void isolateMaximalRoot();
+
   /*!	\fn numberRootsUnitCircle(GEN gPol);
    * 	For a palindromic polynomial, try to compute the number of zeros on the
    * unit circle \param gPol (GEN, PARI polynomial) \return Number of roots on
@@ -50,6 +50,12 @@ bool Index2::isVertexAdmissible(const string &vertexLabel) {
 bool Index2::removeVertex(const string &vertexName) {
   unsigned int weight;
 
+  // The graph may have been doubled since the creation of the object
+  coxeterMatrix = ci->get_coxeterMatrix();
+  verticesCount = ci->get_verticesCount();
+  newVertices.clear();
+  iNewVerticesCount = 0;
+
   // -------------------------------------------------------
   // some verifications, firsts constructions
   if (!isVertexAdmissible(vertexName))
@@ -62,6 +68,7 @@ bool Index2::removeVertex(const string &vertexName) {
 
   // -------------------------------------------------------
   // new vertices
+  vector<unsigned int> originVertices;
   for (unsigned int i(0); i < verticesCount; i++) {
     // If they don't commute, this will add a new vertex
     if (coxeterMatrix[vertex][i] != 2) {
@@ -72,26 +79,17 @@ bool Index2::removeVertex(const string &vertexName) {
       nv.label = ci->get_vertexLabel(vertex) + "_" + ci->get_vertexLabel(i);
 
       newVertices.push_back(nv);
-      ci->map_vertices_labels_addReference(nv.label);
+      originVertices.push_back(i);
 
       iNewVerticesCount++;
     }
   }
 
-  ci->map_vertices_labels_removeReference(vertex);
-
   // -------------------------------------------------------
-  // new adjacency matrix
-  for (unsigned int i(0); i <= (verticesCount + iNewVerticesCount - 1);
-       i++) // the -1 is for the vertex we removed
-  {
-    if (i == vertex)
-      continue;
-
-    iNewCox.push_back(
-        vector<unsigned int>(verticesCount + iNewVerticesCount - 1,
-                             2)); // TODO: tout construire en une fois
-  }
+  // new adjacency matrix (the -1 is for the vertex we removed)
+  const unsigned int iNewCount(verticesCount + iNewVerticesCount - 1);
+  iNewCox = vector<vector<unsigned int>>(iNewCount,
+                                         vector<unsigned int>(iNewCount, 2));
 
   // we fill the old values (upper left square)
   for (unsigned int i(0); i < verticesCount; i++) {
@@ -153,7 +151,15 @@ bool Index2::removeVertex(const string &vertexName) {
     }
   }
 
-  ci->set_coxeterMatrix(iNewCox);
+  // -------------------------------------------------------
+  // labels
+  ci->map_vertices_labels_removeReference(vertex);
+
+  for (const auto &nv : newVertices)
+    ci->map_vertices_labels_addReference(nv.label);
+
+  // If the graph was explored, its subgraphs are used for the new graph
+  ci->set_coxeterMatrix_index2(iNewCox, vertex, originVertices);
 
   return true;
 }
@@ -163,9 +169,9 @@ void Index2::printMatrix(vector<vector<unsigned int>> *iMatrix) {
        itRow != iMatrix->end(); ++itRow) {
     for (vector<unsigned int>::const_iterator itCol((*itRow).begin());
          itCol != (*itRow).end(); ++itCol)
-      cout << *itCol << " ";
+      ci->get_output() << *itCol << " ";
 
-    cout << endl;
+    ci->get_output() << endl;
   }
 }
 
@@ -0,0 +1,187 @@
+/*
+Copyright (C) 2013-2017
+Rafael Guglielmetti, rafael.guglielmetti@unifr.ch
+*/
+
+/*
+This file is part of CoxIter and AlVin.
+
+CoxIter is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+CoxIter is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "json.h"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+JSONWriter::JSONWriter(ostream &out) : out(out), isAfterKey(false) {}
+
+void JSONWriter::separator() {
+  if (isAfterKey) {
+    isAfterKey = false;
+    return;
+  }
+
+  if (!isFirstValue.empty()) {
+    if (!isFirstValue.back())
+      out << ',';
+    isFirstValue.back() = false;
+  }
+}
+
+JSONWriter &JSONWriter::beginObject() {
+  separator();
+  out << '{';
+  isFirstValue.push_back(true);
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::endObject() {
+  out << '}';
+  isFirstValue.pop_back();
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::beginArray() {
+  separator();
+  out << '[';
+  isFirstValue.push_back(true);
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::endArray() {
+  out << ']';
+  isFirstValue.pop_back();
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::key(const string &name) {
+  separator();
+  escape(out, name);
+  out << ':';
+  isAfterKey = true;
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::value(const string &str) {
+  separator();
+  escape(out, str);
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::value(const char *str) { return value(string(str)); }
+
+JSONWriter &JSONWriter::value(const bool &b) {
+  separator();
+  out << (b ? "true" : "false");
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::value(const int &i) {
+  separator();
+  out << i;
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::value(const unsigned int &i) {
+  separator();
+  out << i;
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::value(const long int &i) {
+  separator();
+  out << i;
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::value(const unsigned long int &i) {
+  separator();
+  out << i;
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::value(const double &d) {
+  if (!std::isfinite(d)) // Not representable in JSON
+    return null();
+
+  separator();
+
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.*g", numeric_limits<double>::digits10,
+           d);
+  out << buffer;
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::number(const string &digits) {
+  separator();
+  out << digits;
+
+  return *this;
+}
+
+JSONWriter &JSONWriter::null() {
+  separator();
+  out << "null";
+
+  return *this;
+}
+
+void JSONWriter::escape(ostream &out, const string &str) {
+  out << '"';
+
+  for (const char &c : str) {
+    switch (c) {
+    case '"':
+      out << "\\\"";
+      break;
+    case '\\':
+      out << "\\\\";
+      break;
+    case '\n':
+      out << "\\n";
+      break;
+    case '\r':
+      out << "\\r";
+      break;
+    case '\t':
+      out << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+        char buffer[8];
+        snprintf(buffer, sizeof(buffer), "\\u%04x",
+                 static_cast<unsigned int>(c));
+        out << buffer;
+      } else
+        out << c;
+    }
+  }
+
+  out << '"';
+}
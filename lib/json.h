@@ -0,0 +1,103 @@
+/*
+Copyright (C) 2013-2017
+Rafael Guglielmetti, rafael.guglielmetti@unifr.ch
+*/
+
+/*
+This file is part of CoxIter and AlVin.
+
+CoxIter is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+CoxIter is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*!
+ * \file json.h
+ * \brief Streaming JSON writer
+ * \author Rafael Guglielmetti
+ * \class JSONWriter json.h
+ *
+ * The values are written directly to the stream (nothing is kept in memory
+ * except the nesting of the objects and arrays). The writer does not check
+ * that the calls are consistent (e.g. that a key is given for each member of
+ * an object).
+ *
+ * Example:
+ * 	JSONWriter json(cout);
+ * 	json.beginObject().key("vertices").value(5).endObject();
+ */
+
+#ifndef __JSON_H__
+#define __JSON_H__ 1
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class JSONWriter {
+private:
+  ostream &out;              ///< Where the JSON is written
+  vector<bool> isFirstValue; ///< For each opened object/array: true if no
+                             ///< value was written yet
+  bool isAfterKey;           ///< True if a key was just written
+
+public:
+  JSONWriter(ostream &out);
+
+  JSONWriter &beginObject();
+  JSONWriter &endObject();
+  JSONWriter &beginArray();
+  JSONWriter &endArray();
+
+  /*!	\fn key
+   * 	\brief Write the key of the next member of the current object
+   * 	\param name(const string&) Key
+   * 	\return The writer
+   */
+  JSONWriter &key(const string &name);
+
+  JSONWriter &value(const string &str);
+  JSONWriter &value(const char *str);
+  JSONWriter &value(const bool &b);
+  JSONWriter &value(const int &i);
+  JSONWriter &value(const unsigned int &i);
+  JSONWriter &value(const long int &i);
+  JSONWriter &value(const unsigned long int &i);
+  JSONWriter &value(const double &d);
+
+  /*!	\fn number
+   * 	\brief Write a number given by its decimal representation (e.g. a big
+   * integer), without quotes
+   * 	\param digits(const string&) The number
+   * 	\return The writer
+   */
+  JSONWriter &number(const string &digits);
+
+  JSONWriter &null();
+
+  /*!	\fn escape
+   * 	\brief Write a string between quotes, escaping the special characters
+   * 	\param out(ostream&) Stream
+   * 	\param str(const string&) String
+   */
+  static void escape(ostream &out, const string &str);
+
+private:
+  /*!	\fn separator
+   * 	\brief Write the comma if a value precedes in the current object/array
+   */
+  void separator();
+};
+
+#endif
@@ -45,23 +45,28 @@ MPZ_rational::MPZ_rational(string rational) {
   str_replace(rational, " ", "");
 
   PCRERegexp reg;
-  PCREResult results;
+  PCREOffsets offsets;
   int iRegexpCount;
 
+  auto group = [&rational, &offsets](const unsigned int &i) -> string {
+    return rational.substr(offsets[i].first,
+                           offsets[i].second - offsets[i].first);
+  };
+
   // rationnel sous la forme: a
-  iRegexpCount = reg.preg_match_all("^[\\+]{0,1}([\\-]{0,1})([[:digit:]]+)$",
-                                    rational, results);
+  iRegexpCount = reg.preg_match("^[\\+]{0,1}([\\-]{0,1})([[:digit:]]+)$",
+                                rational, offsets);
   if (iRegexpCount == -1)
     throw(0);
   else if (iRegexpCount > 0) {
-    a = mpz_class(results[2][0].c_str(), 10);
+    a = mpz_class(group(2), 10);
 
     b = 1;
 
     if (b == 0)
       throw(0);
 
-    if (results[1][0] == "-")
+    if (offsets[1].second > offsets[1].first) // "-"
       a *= -1;
 
     update();
@@ -69,19 +74,19 @@ MPZ_rational::MPZ_rational(string rational) {
   }
 
   // rationnel sous la forme: a/b
-  iRegexpCount = reg.preg_match_all(
+  iRegexpCount = reg.preg_match(
       "^[\\+]{0,1}([\\-]{0,1})([[:digit:]]+)\\/([[:digit:]]+)$", rational,
-      results);
+      offsets);
   if (iRegexpCount == -1)
     throw(0);
   else if (iRegexpCount > 0) {
-    a = mpz_class(results[2][0], 10);
-    b = mpz_class(results[3][0], 10);
+    a = mpz_class(group(2), 10);
+    b = mpz_class(group(3), 10);
 
     if (b == 0)
       throw(0);
 
-    if (results[1][0] == "-")
+    if (offsets[1].second > offsets[1].first) // "-"
       a *= -1;
 
     update();
@@ -69,4 +69,16 @@ vector<long int> t_POL2vector(GEN poly) {
 
   return coeffs;
 }
+
+static unsigned int pariUsersCount(0); ///< Number of pariInit not closed
+
+void pariInit() {
+  if (!pariUsersCount++)
+    pari_init(50000000, 2);
+}
+
+void pariClose() {
+  if (pariUsersCount && !--pariUsersCount)
+    pari_close();
+}
 } // namespace PariPolynomials
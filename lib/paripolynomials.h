@@ -60,6 +60,20 @@ GEN vector2t_POL(const vector<mpz_class> &iCoefficients);
  * 	\return Vector (vector< long int >)
  */
 vector<long int> t_POL2vector(GEN poly);
+
+/*!	\fn pariInit
+ * 	\brief Initialize PARI, unless it is already initialized
+ *
+ * 	Each call must be followed by a call to pariClose: PARI is closed by the
+ * last one. Hence, several objects (GrowthRate, Signature) can be kept at the
+ * same time.
+ */
+void pariInit();
+
+/*!	\fn pariClose
+ * 	\brief Close PARI if this is the last user (see pariInit)
+ */
+void pariClose();
 } // namespace PariPolynomials
 
 #endif
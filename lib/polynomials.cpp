@@ -23,87 +23,91 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 #include "polynomials.h"
 
 namespace Polynomials {
-vector<vector<mpz_class>> cyclotomicPolynomials = vector<vector<mpz_class>>(
-    {{},
-     {-1, 1},
-     {1, 1},
-     {1, 1, 1},
-     {1, 0, 1},
-     {1, 1, 1, 1, 1},
-     {1, -1, 1},
-     {1, 1, 1, 1, 1, 1, 1},
-     {1, 0, 0, 0, 1},
-     {1, 0, 0, 1, 0, 0, 1},
-     {1, -1, 1, -1, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, -1, 0, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, -1, 1, -1, 1, -1, 1},
-     {1, -1, 0, 1, -1, 1, 0, -1, 1},
-     {1, 0, 0, 0, 0, 0, 0, 0, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, 0, -1, 0, 0, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, -1, 0, 1, 0, -1, 0, 1},
-     {1, -1, 0, 1, -1, 0, 1, 0, -1, 1, 0, -1, 1},
-     {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, 0, 0, -1, 0, 0, 0, 1},
-     {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1},
-     {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
-     {1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-     {1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1, 0, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 1, 0, -1, -1, -1, 0, 1, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-     {1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1},
-     {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
-     {1,  -1, 0, 0,  0, 1,  -1, 1, -1, 0, 1,  -1, 1,
-      -1, 1,  0, -1, 1, -1, 1,  0, 0,  0, -1, 1},
-     {1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
-     {1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1,
-      0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1},
-     {1, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 1, 0, -1, -1, 0, 1, 0, -1, -1, 0, 1, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1, 0, 1},
-     {1, 0, 0, -1, 0, 0, 0, 0, 0,  1, 0, 0, -1,
-      0, 0, 1, 0,  0, 0, 0, 0, -1, 0, 0, 1},
-     {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
-      1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1},
-     {1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1,
-      0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1},
-     {1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1},
-     {1, -1, 0,  1, -1, 0,  1, -1, 0,  1, -1, 0,  1, -1, 0,  1, -1,
-      1, 0,  -1, 1, 0,  -1, 1, 0,  -1, 1, 0,  -1, 1, 0,  -1, 1},
-     {1, 0,  -1, 0, 1, 0,  -1, 0, 1, 0,  -1, 0, 1,
-      0, -1, 0,  1, 0, -1, 0,  1, 0, -1, 0,  1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
-     {1, -1, 0,  0, 0, 1, -1, 0,  0, 0, 1, 0, -1, 0,  0, 1, 0, -1, 0,  0, 1,
-      0, 0,  -1, 0, 1, 0, 0,  -1, 0, 1, 0, 0, 0,  -1, 1, 0, 0, 0,  -1, 1},
-     {1, 0, 0, 0, -1, 0, 0, 0,  1, 0, 0, 0, -1,
-      0, 0, 0, 1, 0,  0, 0, -1, 0, 0, 0, 1},
-     {1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1,
-      0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1},
-     {1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,
-      -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1},
-     {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-     {1, 0, 1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 1, 0, 1}});
+const vector<vector<mpz_class>> &cyclotomicPolynomials() {
+  static const vector<vector<mpz_class>> polynomials(
+      {{},
+       {-1, 1},
+       {1, 1},
+       {1, 1, 1},
+       {1, 0, 1},
+       {1, 1, 1, 1, 1},
+       {1, -1, 1},
+       {1, 1, 1, 1, 1, 1, 1},
+       {1, 0, 0, 0, 1},
+       {1, 0, 0, 1, 0, 0, 1},
+       {1, -1, 1, -1, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, -1, 0, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, -1, 1, -1, 1, -1, 1},
+       {1, -1, 0, 1, -1, 1, 0, -1, 1},
+       {1, 0, 0, 0, 0, 0, 0, 0, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, 0, -1, 0, 0, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, -1, 0, 1, 0, -1, 0, 1},
+       {1, -1, 0, 1, -1, 0, 1, 0, -1, 1, 0, -1, 1},
+       {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, 0, 0, -1, 0, 0, 0, 1},
+       {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1},
+       {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
+       {1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+       {1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1, 0, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 1, 0, -1, -1, -1, 0, 1, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+       {1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1},
+       {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
+       {1,  -1, 0, 0,  0, 1,  -1, 1, -1, 0, 1,  -1, 1,
+        -1, 1,  0, -1, 1, -1, 1,  0, 0,  0, -1, 1},
+       {1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
+       {1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1,
+        0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1},
+       {1, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 1, 0, -1, -1, 0, 1, 0, -1, -1, 0, 1, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1, 0, 1, 0, -1, 0, 1},
+       {1, 0, 0, -1, 0, 0, 0, 0, 0,  1, 0, 0, -1,
+        0, 0, 1, 0,  0, 0, 0, 0, -1, 0, 0, 1},
+       {1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1,
+        1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1},
+       {1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1},
+       {1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1},
+       {1, -1, 0,  1, -1, 0,  1, -1, 0,  1, -1, 0,  1, -1, 0,  1, -1,
+        1, 0,  -1, 1, 0,  -1, 1, 0,  -1, 1, 0,  -1, 1, 0,  -1, 1},
+       {1, 0,  -1, 0, 1, 0,  -1, 0, 1, 0,  -1, 0, 1,
+        0, -1, 0,  1, 0, -1, 0,  1, 0, -1, 0,  1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+       {1, -1, 0,  0, 0, 1, -1, 0,  0, 0, 1, 0, -1, 0,  0, 1, 0, -1, 0,  0, 1,
+        0, 0,  -1, 0, 1, 0, 0,  -1, 0, 1, 0, 0, 0,  -1, 1, 0, 0, 0,  -1, 1},
+       {1, 0, 0, 0, -1, 0, 0, 0,  1, 0, 0, 0, -1,
+        0, 0, 0, 1, 0,  0, 0, -1, 0, 0, 0, 1},
+       {1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1,
+        0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1, 0, -1, 1},
+       {1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,
+        -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1,  -1, 1},
+       {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+       {1, 0, 1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 1, 0, 1}});
+
+  return polynomials;
 }
+} // namespace Polynomials
@@ -49,25 +49,26 @@ namespace Polynomials {
 /*! 	\fn polynomialDisplay
  * 	\brief Display a polynomial
  * 	\param polynomial(const vector< int >& polynomial) Integer
+ * 	\param out(ostream&) Where the polynomial is written
  */
 template <typename Type>
-void polynomialDisplay(const vector<Type> &polynomial) {
+void polynomialDisplay(const vector<Type> &polynomial, ostream &out = cout) {
   bool isFirst(true);
   unsigned int iSize(polynomial.size());
 
   for (unsigned int i(0); i < iSize; i++) {
     if (polynomial[i] != 0) {
       if (isFirst) {
-        cout << polynomial[i]
-             << (i ? " * x" + string(i > 1 ? "^" + to_string(i) : "") : "");
+        out << polynomial[i]
+            << (i ? " * x" + string(i > 1 ? "^" + to_string(i) : "") : "");
         isFirst = false;
       } else {
         if ((polynomial[i] != 1 && polynomial[i] != -1) || !i)
-          cout << (polynomial[i] > 0 ? " + " : " - ") << abs(polynomial[i])
-               << (i ? " * x" + string(i > 1 ? "^" + to_string(i) : "") : "");
+          out << (polynomial[i] > 0 ? " + " : " - ") << abs(polynomial[i])
+              << (i ? " * x" + string(i > 1 ? "^" + to_string(i) : "") : "");
         else
-          cout << (polynomial[i] > 0 ? " + " : " - ")
-               << "x" + string(i > 1 ? "^" + to_string(i) : "");
+          out << (polynomial[i] > 0 ? " + " : " - ")
+              << "x" + string(i > 1 ? "^" + to_string(i) : "");
       }
     }
   }
@@ -76,21 +77,23 @@ void polynomialDisplay(const vector<Type> &polynomial) {
 /*! 	\fn symbolDisplay
  * 	\brief Display a symbol
  * 	\param symbol(const vector< int >& symbol) Integer
+ * 	\param out(ostream&) Where the symbol is written
  */
-template <typename Type> void symbolDisplay(const vector<Type> &symbol) {
+template <typename Type>
+void symbolDisplay(const vector<Type> &symbol, ostream &out = cout) {
   bool isFirst(true);
   unsigned int iSize(symbol.size());
 
-  cout << "[";
+  out << "[";
   for (unsigned int i(0); i < iSize; i++) {
     if (symbol[i]) {
       for (unsigned int j(0); j < symbol[i]; j++) {
-        cout << (isFirst ? "" : ",") << i;
+        out << (isFirst ? "" : ",") << i;
         isFirst = false;
       }
     }
   }
-  cout << "]";
+  out << "]";
 }
 
 /*! 	\fn polynomialDotSymbol
@@ -238,11 +241,15 @@ bool dividePolynomialByPolynomial(vector<Type> &numerator,
   return true;
 }
 
-extern vector<vector<mpz_class>>
-    cyclotomicPolynomials; ///< List of some cyclotomic polynomials (we want to
-                           ///< be able to multiply/divide with the growth
-                           ///< series so we use here BigInteger instead of
-                           ///< int)
+/*! 	\fn cyclotomicPolynomials
+ * 	\brief List of some cyclotomic polynomials (we want to be able to
+ * multiply/divide with the growth series so we use here BigInteger instead of
+ * int)
+ *
+ * 	The list is built at the first call (thread-safe) and never modified.
+ * 	\return The i-th element is the i-th cyclotomic polynomial
+ */
+const vector<vector<mpz_class>> &cyclotomicPolynomials();
 } // namespace Polynomials
 
 #endif
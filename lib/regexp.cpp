@@ -22,9 +22,40 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include "regexp.h"
 
+#include <map>
+#include <mutex>
+
+namespace {
+/*!
+ * \class PCREPatternsCache
+ * \brief Compiled and studied patterns, shared by all the instances of
+ * PCRERegexp
+ */
+class PCREPatternsCache {
+public:
+  map<pair<string, int>, pair<pcre *, pcre_extra *>> patterns;
+  mutex patternsMutex;
+
+  ~PCREPatternsCache() {
+    for (auto &pattern : patterns) {
+      if (pattern.second.second)
+#ifdef PCRE_STUDY_JIT_COMPILE
+        pcre_free_study(pattern.second.second);
+#else
+        pcre_free(pattern.second.second);
+#endif
+
+      pcre_free(pattern.second.first);
+    }
+  }
+};
+
+PCREPatternsCache patternsCache;
+} // namespace
+
 PCRERegexp::PCRERegexp(int _iOvectorSize)
-    : error(""), isClassUsed(false), regexp(0), regPattern(0), regSubject(0),
-      regError(0), ovector(0), iOvectorSize(_iOvectorSize) {
+    : error(""), regexp(0), regexpExtra(0), regSubject(0), regError(0),
+      ovector(0), iOvectorSize(_iOvectorSize) {
   // ----------------------------------------------
   // ovector
   if (iOvectorSize <= 3)
@@ -36,41 +67,84 @@ PCRERegexp::PCRERegexp(int _iOvectorSize)
 PCRERegexp::~PCRERegexp() {
   delete[] ovector;
   ovector = NULL;
-
-  if (isClassUsed)
-    pcre_free(regexp);
 }
 
 string PCRERegexp::get_error() { return error; }
 
+void PCRERegexp::compile(const string &pattern, const int &optionsCompile) {
+  lock_guard<mutex> lock(patternsCache.patternsMutex);
+
+  auto it(patternsCache.patterns.find(make_pair(pattern, optionsCompile)));
+  if (it != patternsCache.patterns.end()) {
+    regexp = it->second.first;
+    regexpExtra = it->second.second;
+    return;
+  }
+
+  regexp = pcre_compile(pattern.c_str(), optionsCompile, &regError,
+                        &regErrorOffset, NULL);
+  if (regexp == NULL) {
+    error = "PCRE_COMPILATION_ERROR";
+    throw(string("Error: PCRE_COMPILATION_ERROR"));
+  }
+
+  // The pattern is used many times: study it (JIT if available)
+#ifdef PCRE_STUDY_JIT_COMPILE
+  regexpExtra = pcre_study(regexp, PCRE_STUDY_JIT_COMPILE, &regError);
+#else
+  regexpExtra = pcre_study(regexp, 0, &regError);
+#endif
+
+  patternsCache.patterns[make_pair(pattern, optionsCompile)] =
+      make_pair(regexp, regexpExtra);
+}
+
+int PCRERegexp::preg_match(const string &pattern, const string &subject,
+                           PCREOffsets &offsets, const int &startOffset,
+                           const int &optionsCompile) {
+  compile(pattern, optionsCompile);
+  offsets.clear();
+
+  int rc(pcre_exec(regexp, regexpExtra, subject.c_str(), subject.size(),
+                   startOffset, 0, ovector, iOvectorSize));
+
+  if (rc == PCRE_ERROR_NOMATCH)
+    return 0;
+  else if (rc < 0) {
+    error = "UNKNOWN_ERROR";
+    return -1;
+  } else if (rc == 0) // if the vector is too small
+  {
+    error = "PCRE_OVECTOR_TOO_SMALL";
+    return -1;
+  }
+
+  for (int i = 0; i < rc; i++)
+    offsets.push_back(make_pair(ovector[2 * i], ovector[2 * i + 1]));
+
+  return rc;
+}
+
 int PCRERegexp::preg_match_all(const string &pattern, const string &subject,
                                PCREResult &results, const int &optionsCompile) {
   int rc;
   int options(0);
 
-  regPattern = pattern.c_str();
   regSubject = subject.c_str();
   regSubjectLength = subject.size();
 
   // ----------------------------------------------------
-  // compilation of the regexp
-  regexp = pcre_compile(regPattern, optionsCompile, &regError, &regErrorOffset,
-                        NULL);
-  if (regexp == NULL) {
-    throw(string("Error: PCRE_COMPILATION_ERROR"));
-    error = "PCRE_COMPILATION_ERROR";
-    return -1;
-  }
+  // compilation of the regexp (or from the cache)
+  compile(pattern, optionsCompile);
 
-  isClassUsed = true;
   results.clear();
 
   // ----------------------------------------------------
   // execution of the regexp
   options = 0;
 
-  rc = pcre_exec(regexp, NULL, regSubject, regSubjectLength, 0, options,
-                 ovector, iOvectorSize);
+  rc = pcre_exec(regexp, regexpExtra, regSubject, regSubjectLength, 0,
+                 options, ovector, iOvectorSize);
   if (rc < 0) // no result
     return 0;
   else if (rc == 0) // if the vector is too small
@@ -102,8 +176,8 @@ int PCRERegexp::preg_match_all(const string &pattern, const string &subject,
       options = PCRE_NOTEMPTY | PCRE_ANCHORED;
     }
 
-    rc = pcre_exec(regexp, NULL, regSubject, regSubjectLength, start_offset,
-                   options, ovector, iOvectorSize);
+    rc = pcre_exec(regexp, regexpExtra, regSubject, regSubjectLength,
+                   start_offset, options, ovector, iOvectorSize);
 
     if (rc == PCRE_ERROR_NOMATCH) {
       if (options == 0)
@@ -115,7 +189,6 @@ int PCRERegexp::preg_match_all(const string &pattern, const string &subject,
 
     if (rc < 0) {
       error = "UNKNOWN_ERROR";
-      pcre_free(regexp);
       return -1;
     } else if (rc == 0) {
       error = "PCRE_OVECTOR_TOO_SMALL";
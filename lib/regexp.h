@@ -29,6 +29,7 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <pcre.h>
@@ -41,14 +42,16 @@ using namespace std;
 #include <stdexcept> // std::invalid_argument // TODO: remove
 
 typedef vector<vector<string>> PCREResult;
+typedef vector<pair<int, int>>
+    PCREOffsets; ///< For each group: offsets of the beginning and of the end in
+                 ///< the subject (-1 if the group is not set)
 
 class PCRERegexp {
 private:
-  string error;     ///< Eventually, error code
-  bool isClassUsed; ///< True if the class was used
+  string error; ///< Eventually, error code
 
-  pcre *regexp;
-  const char *regPattern;
+  pcre *regexp;            ///< Compiled pattern (owned by the cache)
+  pcre_extra *regexpExtra; ///< Result of pcre_study (owned by the cache)
   const char *regSubject;
   const char *regError;
 
@@ -74,11 +77,40 @@ public:
   int preg_match_all(const string &pattern, const string &subject,
                      PCREResult &results, const int &optionsCompile = 0);
 
+  /*!	\fn preg_match
+   * 	\brief Executes the regexp and fetch the first occurrence, as offsets in
+   * the subject (nothing is copied)
+   *
+   * 	\param pattern(const string &) The pattern to search for
+   * 	\param subject(const string &) The input string
+   * 	\param offsets(PCREOffsets &) Offsets of the groups of the occurrence
+   * 	\param startOffset(const int&) Where to start in the subject
+   * 	\param optionsCompile(const int&) Options for the regexp
+   * 	\return Number of groups set (including the whole occurrence), 0 if no
+   * occurrence or -1 if an error occurred
+   */
+  int preg_match(const string &pattern, const string &subject,
+                 PCREOffsets &offsets, const int &startOffset = 0,
+                 const int &optionsCompile = 0);
+
   /*! \fn get_error
    * 	\brief Return the error ccode
    * 	\return Error code (string)
    */
   string get_error();
+
+private:
+  /*! \fn compile
+   * 	\brief Get the compiled pattern from the cache (compile and study it
+   * if needed)
+   *
+   * 	The compiled patterns are shared by all the instances and kept until
+   * the end of the program.
+   *
+   * 	\param pattern(const string &) The pattern
+   * 	\param optionsCompile(const int&) Options for the regexp
+   */
+  void compile(const string &pattern, const int &optionsCompile);
 };
 
 #endif
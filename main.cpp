@@ -20,6 +20,7 @@ You should have received a copy of the GNU General Public License
 along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <fstream>
 #include <iostream>
 
 #include "app.h"
@@ -39,10 +40,16 @@ int main(int argc, char **argv) {
     app.bCoutFile = false;
 
   // si la sortie standard est redirigée dans un fichier (-cf)
-  if (app.bCoutFile)
+  ofstream outFile;
+  if (app.bCoutFile) {
     cout << "Output is redirected to " << app.outFilenameBasis << ".output"
          << endl;
 
+    outFile.open((app.outFilenameBasis + ".output").c_str());
+    if (outFile.is_open())
+      app.set_output(outFile);
+  }
+
   app.run();
 
   return 0;
@@ -0,0 +1,203 @@
+"""
+Python interface to CoxIter (through the C interface, see coxiter.capi.h)
+
+The shared library is needed: build CoxIter with -DBUILD_SHARED_LIBS=ON. The
+library is looked for in the path given by the environment variable
+COXITER_LIBRARY, then in the usual places (ctypes.util.find_library).
+
+Example:
+    import coxiter
+    r = coxiter.analyse([[2, 3, 2], [3, 2, 7], [2, 7, 2]], 2,
+                        cocompactness=True)
+    print(r["eulerCharacteristic"], r["isCocompact"])
+
+The matrix can also be a NumPy array. The library is called without the
+global interpreter lock: analyse_many analyses several graphs in parallel.
+"""
+
+import ctypes
+import ctypes.util
+import os
+from concurrent.futures import ThreadPoolExecutor
+from fractions import Fraction
+
+EULER = 1
+COCOMPACTNESS = 2
+FINITE_COVOLUME = 4
+CAN_BE_FINITE_COVOLUME = 8
+GROWTH_SERIES = 16
+ARITHMETICITY = 32
+SEQUENTIAL = 64
+MEMORY_BOUNDED = 128
+STREAMED_CHECK = 256
+
+
+class _Results(ctypes.Structure):
+    _fields_ = [
+        ("dimension", ctypes.c_uint),
+        ("isDimensionGuessed", ctypes.c_int),
+        ("isEulerCharacteristicComputed", ctypes.c_int),
+        ("fVectorAlternateSum", ctypes.c_int),
+        ("verticesAtInfinityCount", ctypes.c_uint),
+        ("fVectorSize", ctypes.c_uint),
+        ("isCocompact", ctypes.c_int),
+        ("isFiniteCovolume", ctypes.c_int),
+        ("canBeFiniteCovolume", ctypes.c_int),
+        ("isArithmetic", ctypes.c_int),
+        ("isGrowthSeriesComputed", ctypes.c_int),
+        ("growthSeries_isFractionReduced", ctypes.c_int),
+    ]
+
+
+def _load():
+    path = os.environ.get("COXITER_LIBRARY") or ctypes.util.find_library(
+        "coxiter")
+    if not path:
+        raise OSError("libcoxiter not found (set COXITER_LIBRARY)")
+
+    lib = ctypes.CDLL(path)
+    graph = ctypes.c_void_p
+    uints = ctypes.POINTER(ctypes.c_uint)
+
+    lib.coxiter_create.restype = graph
+    lib.coxiter_create.argtypes = [uints, ctypes.c_uint, ctypes.c_uint]
+    lib.coxiter_destroy.restype = None
+    lib.coxiter_destroy.argtypes = [graph]
+    lib.coxiter_run.restype = ctypes.c_int
+    lib.coxiter_run.argtypes = [graph, ctypes.c_uint]
+    lib.coxiter_error.restype = ctypes.c_char_p
+    lib.coxiter_error.argtypes = [graph]
+    lib.coxiter_get_results.restype = ctypes.c_int
+    lib.coxiter_get_results.argtypes = [graph, ctypes.POINTER(_Results)]
+
+    for name in ("coxiter_get_fVector",
+                 "coxiter_get_growthSeries_cyclotomicNumerator"):
+        getattr(lib, name).restype = ctypes.c_size_t
+        getattr(lib, name).argtypes = [graph, uints, ctypes.c_size_t]
+
+    for name in ("coxiter_get_eulerCharacteristic",
+                 "coxiter_get_growthSeries_polynomialDenominator"):
+        getattr(lib, name).restype = ctypes.c_size_t
+        getattr(lib, name).argtypes = [graph, ctypes.c_char_p, ctypes.c_size_t]
+
+    return lib
+
+
+_lib = None
+
+
+def _library():
+    global _lib
+    if _lib is None:
+        _lib = _load()
+    return _lib
+
+
+def _flatten(matrix):
+    """Entries of the matrix, row by row, number of vertices and the object
+    which owns the entries (which has to be kept alive during the call)"""
+    if hasattr(matrix, "shape"):  # NumPy array: no copy if already uint32
+        import numpy
+
+        matrix = numpy.ascontiguousarray(matrix, dtype=numpy.uint32)
+        if matrix.ndim != 2 or matrix.shape[0] != matrix.shape[1]:
+            raise ValueError("The Coxeter matrix is not a square matrix")
+        count = matrix.shape[0]
+        return matrix.ctypes.data_as(ctypes.POINTER(ctypes.c_uint)), count, \
+            matrix
+
+    count = len(matrix)
+    orders = (ctypes.c_uint * (count * count))()
+    for i, row in enumerate(matrix):
+        if len(row) != count:
+            raise ValueError("The Coxeter matrix is not a square matrix")
+        orders[i * count:(i + 1) * count] = [int(o) for o in row]
+
+    return orders, count, orders
+
+
+def _string(function, graph):
+    size = function(graph, None, 0)
+    buffer = ctypes.create_string_buffer(size + 1)
+    function(graph, buffer, size + 1)
+    return buffer.value.decode()
+
+
+def _vector(function, graph):
+    size = function(graph, None, 0)
+    buffer = (ctypes.c_uint * size)()
+    function(graph, buffer, size)
+    return list(buffer)
+
+
+def analyse(matrix, dimension=0, euler=True, cocompactness=False,
+            finiteCovolume=False, canBeFiniteCovolume=False,
+            growthSeries=False, arithmeticity=False, sequential=False,
+            memoryBounded=False, streamedCheck=False):
+    """Analyse the graph given by its Coxeter matrix
+
+    The entries are the orders of the edges (0 for a bold edge, 1 for a
+    dotted edge, 2 if there is no edge). The tests give 1 (yes), 0 (no), -1
+    (don't know) or -2 (not tested). memoryBounded and streamedCheck lower the
+    memory used by the cocompactness and finite covolume tests (see
+    CoxIter::set_memoryBounded and CoxIter::set_streamedCheck).
+    Raise RuntimeError if the graph cannot be analysed.
+    """
+    lib = _library()
+    orders, count, owner = _flatten(matrix)  # owner: kept until the end
+
+    flags = (EULER if euler else 0) | \
+        (COCOMPACTNESS if cocompactness else 0) | \
+        (FINITE_COVOLUME if finiteCovolume else 0) | \
+        (CAN_BE_FINITE_COVOLUME if canBeFiniteCovolume else 0) | \
+        (GROWTH_SERIES if growthSeries else 0) | \
+        (ARITHMETICITY if arithmeticity else 0) | \
+        (SEQUENTIAL if sequential else 0) | \
+        (MEMORY_BOUNDED if memoryBounded else 0) | \
+        (STREAMED_CHECK if streamedCheck else 0)
+
+    graph = lib.coxiter_create(orders, count, dimension)
+    if not graph:
+        raise MemoryError("Cannot create the graph")
+
+    try:
+        if not lib.coxiter_run(graph, flags):
+            raise RuntimeError(lib.coxiter_error(graph).decode())
+
+        r = _Results()
+        lib.coxiter_get_results(graph, ctypes.byref(r))
+        results = {name: getattr(r, name) for name, _ in _Results._fields_
+                   if name != "fVectorSize"}
+        for name in ("isDimensionGuessed", "isEulerCharacteristicComputed",
+                     "isGrowthSeriesComputed",
+                     "growthSeries_isFractionReduced"):
+            results[name] = bool(results[name])
+
+        if r.isEulerCharacteristicComputed:
+            results["eulerCharacteristic"] = Fraction(
+                _string(lib.coxiter_get_eulerCharacteristic, graph))
+            results["fVector"] = _vector(lib.coxiter_get_fVector, graph)
+
+        if r.isGrowthSeriesComputed:
+            results["growthSeries_cyclotomicNumerator"] = _vector(
+                lib.coxiter_get_growthSeries_cyclotomicNumerator, graph)
+            denominator = _string(
+                lib.coxiter_get_growthSeries_polynomialDenominator, graph)
+            results["growthSeries_polynomialDenominator"] = \
+                [int(c) for c in denominator.split(",") if c]
+    finally:
+        lib.coxiter_destroy(graph)
+
+    return results
+
+
+def analyse_many(matrices, dimension=0, threads=None, **analyses):
+    """Analyse several graphs in parallel (one graph per thread)
+
+    The arguments are those of analyse; the results are given in the order
+    of the matrices.
+    """
+    analyses["sequential"] = True
+    with ThreadPoolExecutor(max_workers=threads) as executor:
+        return list(executor.map(
+            lambda matrix: analyse(matrix, dimension, **analyses), matrices))
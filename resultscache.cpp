@@ -0,0 +1,201 @@
+/*
+Copyright (C) 2013-2017
+Rafael Guglielmetti, rafael.guglielmetti@unifr.ch
+*/
+
+/*
+This file is part of CoxIter.
+
+CoxIter is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+CoxIter is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "resultscache.h"
+
+ResultsCache::ResultsCache() {}
+
+bool ResultsCache::open(const string &filename) {
+  lock_guard<mutex> lock(entriesMutex);
+
+  this->filename = filename;
+  entries.clear();
+  error = "";
+
+  ifstream fileIn(filename.c_str());
+  if (fileIn.is_open()) {
+    string line, key;
+    CoxIter_Results results;
+
+    while (getline(fileIn, line)) {
+      if (unserialize(line, key, results))
+        entries[key] = results;
+    }
+    fileIn.close();
+  }
+
+  fileOut.open(filename.c_str(), ios::app);
+  if (!fileOut.is_open()) {
+    error = "Cannot open the cache file: " + filename;
+    return false;
+  }
+
+  return true;
+}
+
+bool ResultsCache::get(const string &key, CoxIter_Results &results) {
+  lock_guard<mutex> lock(entriesMutex);
+
+  auto it(entries.find(key));
+  if (it == entries.end())
+    return false;
+
+  results = it->second;
+  return true;
+}
+
+bool ResultsCache::put(const string &key, const CoxIter_Results &results) {
+  lock_guard<mutex> lock(entriesMutex);
+
+  if (!fileOut.is_open()) {
+    error = "Cache file not opened";
+    return false;
+  }
+
+  auto it(entries.find(key));
+  if (it == entries.end())
+    it = entries.insert(make_pair(key, results)).first;
+  else {
+    // We keep what was known but not computed this time
+    CoxIter_Results &entry(it->second);
+
+    entry.dimension = results.dimension;
+    entry.isDimensionGuessed = results.isDimensionGuessed;
+
+    if (results.isEulerCharacteristicComputed) {
+      entry.isEulerCharacteristicComputed = true;
+      entry.eulerCharacteristic = results.eulerCharacteristic;
+      entry.fVector = results.fVector;
+      entry.fVectorAlternateSum = results.fVectorAlternateSum;
+      entry.verticesAtInfinityCount = results.verticesAtInfinityCount;
+    }
+
+    if (results.isCocompact != -2)
+      entry.isCocompact = results.isCocompact;
+
+    if (results.isFiniteCovolume != -2)
+      entry.isFiniteCovolume = results.isFiniteCovolume;
+
+    if (results.isGrowthSeriesComputed) {
+      entry.isGrowthSeriesComputed = true;
+      entry.growthSeries_cyclotomicNumerator =
+          results.growthSeries_cyclotomicNumerator;
+      entry.growthSeries_polynomialDenominator =
+          results.growthSeries_polynomialDenominator;
+      entry.growthSeries_isFractionReduced =
+          results.growthSeries_isFractionReduced;
+    }
+  }
+
+  fileOut << serialize(key, it->second) << endl;
+  if (fileOut.fail()) {
+    error = "Cannot write in the cache file: " + filename;
+    return false;
+  }
+
+  return true;
+}
+
+string ResultsCache::get_error() const { return error; }
+
+string ResultsCache::serialize(const string &key,
+                               const CoxIter_Results &results) {
+  ostringstream line;
+
+  line << key << "\t" << results.dimension << "\t"
+       << results.isDimensionGuessed << "\t"
+       << results.isEulerCharacteristicComputed << "\t"
+       << results.eulerCharacteristic.to_string() << "\t"
+       << implode(",", results.fVector) << "\t" << results.fVectorAlternateSum
+       << "\t" << results.verticesAtInfinityCount << "\t"
+       << results.isCocompact << "\t" << results.isFiniteCovolume << "\t"
+       << results.isGrowthSeriesComputed << "\t"
+       << implode(",", results.growthSeries_cyclotomicNumerator) << "\t";
+
+  for (size_t i(0); i < results.growthSeries_polynomialDenominator.size(); i++)
+    line << (i ? "," : "") << results.growthSeries_polynomialDenominator[i];
+
+  line << "\t" << results.growthSeries_isFractionReduced;
+
+  return line.str();
+}
+
+bool ResultsCache::unserialize(const string &line, string &key,
+                               CoxIter_Results &results) {
+  // Fields separated by tabulations (a field can be empty)
+  vector<string> fields;
+  size_t start(0), end;
+  while ((end = line.find('\t', start)) != string::npos) {
+    fields.push_back(line.substr(start, end - start));
+    start = end + 1;
+  }
+  fields.push_back(line.substr(start));
+
+  if (fields.size() != 14)
+    return false;
+
+  // Comma separated list of numbers
+  auto numbers = [](const string &list) {
+    vector<string> items;
+    size_t start(0), end;
+
+    if (list == "")
+      return items;
+
+    while ((end = list.find(',', start)) != string::npos) {
+      items.push_back(list.substr(start, end - start));
+      start = end + 1;
+    }
+    items.push_back(list.substr(start));
+
+    return items;
+  };
+
+  try {
+    results = CoxIter_Results();
+    key = fields[0];
+
+    results.dimension = stoul(fields[1]);
+    results.isDimensionGuessed = fields[2] == "1";
+
+    results.isEulerCharacteristicComputed = fields[3] == "1";
+    results.eulerCharacteristic = MPZ_rational(fields[4]);
+    for (const auto &f : numbers(fields[5]))
+      results.fVector.push_back(stoul(f));
+    results.fVectorAlternateSum = stoi(fields[6]);
+    results.verticesAtInfinityCount = stoul(fields[7]);
+
+    results.isCocompact = stoi(fields[8]);
+    results.isFiniteCovolume = stoi(fields[9]);
+
+    results.isGrowthSeriesComputed = fields[10] == "1";
+    for (const auto &c : numbers(fields[11]))
+      results.growthSeries_cyclotomicNumerator.push_back(stoul(c));
+    for (const auto &c : numbers(fields[12]))
+      results.growthSeries_polynomialDenominator.push_back(mpz_class(c, 10));
+    results.growthSeries_isFractionReduced = fields[13] == "1";
+  } catch (...) { // Invalid number (std::invalid_argument, MPZ_rational, GMP)
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,106 @@
+/*
+Copyright (C) 2013-2017
+Rafael Guglielmetti, rafael.guglielmetti@unifr.ch
+*/
+
+/*
+This file is part of CoxIter.
+
+CoxIter is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+CoxIter is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*!
+ * \file resultscache.h
+ * \author Rafael Guglielmetti
+ *
+ * \class ResultsCache
+ * \brief Persistent cache of the invariants, keyed by the canonical form of
+ * the graph (see CoxIter::get_canonicalForm)
+ *
+ * The cache is a text file with one entry per line (the canonical form,
+ * followed by the invariants, separated by tabulations). The entries are
+ * appended to the file: if a key appears several times, the last entry is
+ * used.
+ */
+
+#ifndef __RESULTSCACHE_H__
+#define __RESULTSCACHE_H__
+
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+#include "coxiter.h"
+
+class ResultsCache {
+private:
+  string filename; ///< Path to the file
+  ofstream fileOut; ///< To append the new entries
+  unordered_map<string, CoxIter_Results> entries; ///< Key -> invariants
+  mutex entriesMutex; ///< The cache can be shared by threads (batch mode)
+
+  string error; ///< Error (if any)
+
+public:
+  ResultsCache();
+
+  /*!	\fn open
+   * 	\brief Read the entries of a file (which is created if needed)
+   * 	\param filename(const string&) Path to the file
+   * 	\return True if success
+   */
+  bool open(const string &filename);
+
+  /*!	\fn get
+   * 	\brief Find the invariants of a graph
+   *
+   * 	\param key(const string&) Canonical form of the graph
+   * 	\param results(CoxIter_Results&) The invariants (if found)
+   * 	\return True if the graph is in the cache
+   */
+  bool get(const string &key, CoxIter_Results &results);
+
+  /*!	\fn put
+   * 	\brief Add (or complete) the invariants of a graph
+   *
+   * 	The invariants which are not computed in results are taken from the
+   * current entry (if any).
+   *
+   * 	\param key(const string&) Canonical form of the graph
+   * 	\param results(const CoxIter_Results&) The invariants
+   * 	\return True if success
+   */
+  bool put(const string &key, const CoxIter_Results &results);
+
+  string get_error() const;
+
+private:
+  /*!	\fn serialize
+   * 	\brief Write an entry as a line (without the end of line)
+   */
+  static string serialize(const string &key, const CoxIter_Results &results);
+
+  /*!	\fn unserialize
+   * 	\brief Read an entry from a line
+   * 	\return True if the line is valid
+   */
+  static bool unserialize(const string &line, string &key,
+                          CoxIter_Results &results);
+};
+
+#endif // __RESULTSCACHE_H__
@@ -22,26 +22,28 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include "signature.h"
 
-Signature::Signature() {
-  pari_init(50000000, 2);
+Signature::Signature() { PariPolynomials::pariInit(); }
 
-  /*
-   * Note: gEpsilon must be BIG compared to the precision up to which we compute
-   * the eigenvalues
-   * */
-  gEpsilon = dbltor(1e-40);
-}
-
-Signature::~Signature() { pari_close(); }
+Signature::~Signature() { PariPolynomials::pariClose(); }
 
 std::array<unsigned int, int(3)> Signature::computeSignature(string matrix) {
   array<unsigned int, int(3)> signature({0, 0, 0});
   GEN gMatrix;
 
+  // The PARI stack is cleaned before returning: the instance can be kept
+  pari_sp ltop = avma;
+
+  /*
+   * Note: gEpsilon must be BIG compared to the precision up to which we compute
+   * the eigenvalues
+   * */
+  GEN gEpsilon(dbltor(1e-40));
+
   long prec;
   setrealprecision(57, &prec); // increase precision for the gp_read_str
 
   pari_CATCH(CATCH_ALL) {
+    avma = ltop;
     throw(string(
         "Signature::computeSignature: Incorrect matrix; check the weights"));
   }
@@ -63,5 +65,6 @@ std::array<unsigned int, int(3)> Signature::computeSignature(string matrix) {
       signature[0]++;
   }
 
+  avma = ltop;
   return signature;
 }
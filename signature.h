@@ -35,12 +35,11 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 #include <pari/pari.h>
 #include <string>
 
+#include "lib/paripolynomials.h"
+
 using namespace std;
 
 class Signature {
-private:
-  GEN gEpsilon; ///< Some small number (typically 10^-50)
-
 public:
   Signature();
   ~Signature();
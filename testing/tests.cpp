@@ -22,7 +22,7 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 
 #include "tests.h"
 
-Tests::Tests() {}
+Tests::Tests() : smallGraphsMaxVertices(14) {}
 
 bool Tests::readGraphsFile(string input) {
   // ------------------------------------------------------
@@ -285,6 +285,9 @@ bool Tests::runTests() {
     // Tests
     runTests_growth(i, &ci);
 
+    if (tests[i].growthRate != "")
+      runTests_growthRateThreshold(i, &ci);
+
     runTests_signature(i, &ci, iDim);
 
     runTests_cocompactness_cofiniteness(i, &ci);
@@ -294,6 +297,22 @@ bool Tests::runTests() {
 
     runTests_euler(i, &ci);
     runTests_fVector(i, &ci);
+
+    // ---------------------------------------------
+    // Same results, computed in other ways
+    if (ci.get_verticesCount() <= smallGraphsMaxVertices) {
+      CoxIter_Results reference;
+
+      if (runTests_reference(i, reference)) {
+        runTests_binary(i, reference);
+        runTests_removeAddVertex(i, reference);
+        runTests_sweep(i);
+        runTests_symmetries(i, reference);
+        runTests_memoryBounded(i, reference);
+        runTests_capi(i, reference);
+        runTests_index2(i);
+      }
+    }
   }
 
   cout << "\n" << endl;
@@ -314,7 +333,11 @@ string Tests::get_error() const { return error; }
 void Tests::runTests_init() {
   testsSucceded.clear();
 
+  testsSucceded["addVertex"] = array<unsigned int, 2>{0, 0};
   testsSucceded["arithmeticity"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["binary"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["capi"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["capiSecondCall"] = array<unsigned int, 2>{0, 0};
   testsSucceded["cocompactness"] = array<unsigned int, 2>{0, 0};
   testsSucceded["cofiniteness"] = array<unsigned int, 2>{0, 0};
   testsSucceded["cofinitenessPartial"] = array<unsigned int, 2>{0, 0};
@@ -323,15 +346,29 @@ void Tests::runTests_init() {
   testsSucceded["fv"] = array<unsigned int, 2>{0, 0};
   testsSucceded["fvAlt"] = array<unsigned int, 2>{0, 0};
   testsSucceded["growthRate"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["growthRateBounds"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["growthRateRefine"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["growthRateThreshold"] = array<unsigned int, 2>{0, 0};
   testsSucceded["growthSeries"] = array<unsigned int, 2>{0, 0};
   testsSucceded["growthSeriesDenomDimOdd"] = array<unsigned int, 2>{0, 0};
   testsSucceded["growthSeriesEuler"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["index2"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["memoryBounded"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["memoryBoundedStreamed"] = array<unsigned int, 2>{0, 0};
   testsSucceded["readingGraph"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["removeVertices"] = array<unsigned int, 2>{0, 0};
   testsSucceded["signature"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["streamedCheck"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["sweep"] = array<unsigned int, 2>{0, 0};
+  testsSucceded["symmetries"] = array<unsigned int, 2>{0, 0};
 
   testsUnknownErrors = 0;
 
+  testDescription["addVertex"] = "Adding a vertex";
   testDescription["arithmeticity"] = "Arithmeticity";
+  testDescription["binary"] = "Binary graph (round trip)";
+  testDescription["capi"] = "C interface";
+  testDescription["capiSecondCall"] = "C interface (second call)";
   testDescription["cocompactness"] = "Cocompactness";
   testDescription["cofiniteness"] = "Cofiniteness";
   testDescription["cofinitenessPartial"] = "Cofiniteness (partial)";
@@ -340,12 +377,22 @@ void Tests::runTests_init() {
   testDescription["fv"] = "f-vector";
   testDescription["fvAlt"] = "Alt. sum comp. f-vector";
   testDescription["growthRate"] = "Growth rate";
+  testDescription["growthRateBounds"] = "Growth rate (bounds)";
+  testDescription["growthRateRefine"] = "Growth rate (refined)";
+  testDescription["growthRateThreshold"] = "Growth rate (threshold)";
   testDescription["growthSeries"] = "Growth series";
   testDescription["growthSeriesDenomDimOdd"] =
       "Denom. growth series vanish at 1";
   testDescription["growthSeriesEuler"] = "Growth series <-> Euler char.";
+  testDescription["index2"] = "Index 2 (derived subgraphs)";
+  testDescription["memoryBounded"] = "Memory-bounded mode";
+  testDescription["memoryBoundedStreamed"] = "Memory-bounded, streamed check";
   testDescription["readingGraph"] = "Reading graph";
+  testDescription["removeVertices"] = "Removing a vertex";
   testDescription["signature"] = "Signature";
+  testDescription["streamedCheck"] = "Streamed check";
+  testDescription["sweep"] = "Sweep of edges orders";
+  testDescription["symmetries"] = "Enumeration with symmetries";
 }
 
 bool Tests::runTests_computations(const unsigned int &iTestIndex, CoxIter *ci) {
@@ -391,6 +438,28 @@ void Tests::runTests_growth(const unsigned int &testIndex, CoxIter *ci) {
     cout << "INFO: Not a Perron number in " << tests[testIndex].filename
          << endl;
 
+  // The same growth rate, refined from a lower precision
+  if (grr.isComputed) {
+    string growthRateRefined;
+
+    try {
+      GrowthRate grRefine(10);
+      grRefine.grrComputations(ci->get_growthSeries_denominator(), true);
+      growthRateRefined = grRefine.refine(38).growthRate;
+    } catch (const string &ex) {
+      growthRateRefined = ex;
+    }
+
+    if (growthRateRefined == growthRate) {
+      testsSucceded["growthRateRefine"][0]++;
+      of << "OK\tGrowth rate (refined)\t" << tests[testIndex].filename << endl;
+    } else {
+      testsSucceded["growthRateRefine"][1]++;
+      runTestsError(testIndex, "growth rate (refined)", growthRate,
+                    growthRateRefined);
+    }
+  }
+
   // A small test of the growth series
   if (ci->get_isFiniteCovolume() > 0) {
     vector<mpz_class> denom;
@@ -432,7 +501,7 @@ void Tests::runTests_growth(const unsigned int &testIndex, CoxIter *ci) {
 
       for (auto cyclo : cyclotomic) {
         iSum = 0;
-        for (auto coeff : Polynomials::cyclotomicPolynomials[cyclo])
+        for (auto coeff : Polynomials::cyclotomicPolynomials()[cyclo])
           iSum += coeff;
 
         iTotalNum *= iSum;
@@ -452,6 +521,51 @@ void Tests::runTests_growth(const unsigned int &testIndex, CoxIter *ci) {
   }
 }
 
+void Tests::runTests_growthRateThreshold(const unsigned int &testIndex,
+                                         CoxIter *ci) {
+  // Expected growth rate, as a rational number
+  string digits(tests[testIndex].growthRate);
+  const size_t dotPos(digits.find('.'));
+  mpz_class power10(1);
+
+  if (dotPos != string::npos) {
+    mpz_ui_pow_ui(power10.get_mpz_t(), 10, digits.size() - dotPos - 1);
+    digits.erase(dotPos, 1);
+  }
+
+  mpq_class growthRate(mpz_class(digits), power10);
+  growthRate.canonicalize();
+
+  // Thresholds just below and just above the growth rate
+  const mpq_class epsilon(1, 1000000);
+  const int below(ci->growthRate_compare(growthRate * (1 - epsilon))),
+      above(ci->growthRate_compare(growthRate * (1 + epsilon)));
+
+  if (below == 1 && above == 0) {
+    testsSucceded["growthRateThreshold"][0]++;
+    of << "OK\tGrowth rate (threshold)\t" << tests[testIndex].filename
+       << endl;
+  } else {
+    testsSucceded["growthRateThreshold"][1]++;
+    runTestsError(testIndex, "growth rate (threshold)", "yes, no",
+                  strIntToString(below) + ", " + strIntToString(above));
+  }
+
+  // Interval which contains the growth rate
+  mpq_class lower, upper;
+
+  if (ci->growthRate_bounds(lower, upper, 32) && lower <= growthRate &&
+      growthRate <= upper) {
+    testsSucceded["growthRateBounds"][0]++;
+    of << "OK\tGrowth rate (bounds)\t" << tests[testIndex].filename << endl;
+  } else {
+    testsSucceded["growthRateBounds"][1]++;
+    runTestsError(testIndex, "growth rate (bounds)",
+                  tests[testIndex].growthRate,
+                  "[" + lower.get_str() + ", " + upper.get_str() + "]");
+  }
+}
+
 void Tests::runTests_signature(const unsigned int &testIndex, CoxIter *ci,
                                const unsigned int &dim) {
   int signatureComputed(0);
@@ -491,8 +605,8 @@ void Tests::runTests_signature(const unsigned int &testIndex, CoxIter *ci,
   }
 
   // ---------------------------------------
-  // Guessing the dimension
-  if (ci->get_dimensionGuessed()) {
+  // Guessing the dimension (if the file gives it)
+  if (ci->get_dimensionGuessed() && dim) {
     if (dim == ci->get_dimension()) {
       testsSucceded["dimensionGuess"][0]++;
       of << "OK\tDimension guessed\t" << tests[testIndex].filename << endl;
@@ -612,6 +726,289 @@ void Tests::runTests_fVector(const unsigned int &iTestIndex, CoxIter *ci) {
   }
 }
 
+bool Tests::readGraph(const unsigned int &testIndex, CoxIter &ci) {
+  return ci.readGraphFromFile("../../graphs/" + tests[testIndex].filename);
+}
+
+bool Tests::analyse(CoxIter &ci, CoxIter_Results &results) {
+  CoxIter_Analyses analyses;
+  analyses.cocompactness = true;
+  analyses.finiteCovolume = true;
+
+  return ci.analyse(analyses, results);
+}
+
+bool Tests::runTests_reference(const unsigned int &testIndex,
+                               CoxIter_Results &results) {
+  CoxIter ci;
+
+  return readGraph(testIndex, ci) && analyse(ci, results);
+}
+
+void Tests::runTests_binary(const unsigned int &testIndex,
+                            const CoxIter_Results &reference) {
+  CoxIter ci, ciBinary;
+  CoxIter_Results results; // Not computed if a step fails
+  stringstream binary;
+
+  readGraph(testIndex, ci);
+  if (ci.writeBinaryGraph(binary) && ciBinary.parseBinaryGraph(binary))
+    analyse(ciBinary, results);
+
+  runTests_compare(testIndex, "binary", "Binary graph", reference, results);
+}
+
+void Tests::runTests_removeAddVertex(const unsigned int &testIndex,
+                                     const CoxIter_Results &reference) {
+  CoxIter ci, ciRemoved, ciFresh;
+  CoxIter_Results results, resultsFresh;
+
+  if (!readGraph(testIndex, ci) || ci.get_verticesCount() < 2)
+    return;
+
+  // The last vertex is removed from the analysed graph
+  const unsigned int vertex(ci.get_verticesCount() - 1);
+  const string label(ci.get_vertexLabel(vertex));
+
+  analyse(ci, results);
+  results = CoxIter_Results();
+  if (ci.removeVertices(vector<string>(1, label), ciRemoved))
+    analyse(ciRemoved, results);
+
+  ciFresh.set_verticesToRemove(vector<string>(1, label));
+  if (readGraph(testIndex, ciFresh))
+    analyse(ciFresh, resultsFresh);
+
+  runTests_compare(testIndex, "removeVertices", "Removing a vertex",
+                   resultsFresh, results);
+
+  // Then it is added again
+  const vector<vector<unsigned int>> coxeterMatrix(ci.get_coxeterMatrix());
+  vector<unsigned int> orders;
+  for (unsigned int i(0); i < ciRemoved.get_verticesCount(); i++)
+    orders.push_back(coxeterMatrix[ci.get_vertexIndex(
+        ciRemoved.get_vertexLabel(i))][vertex]);
+
+  results = CoxIter_Results();
+  if (ciRemoved.addVertex(orders, label))
+    analyse(ciRemoved, results);
+
+  runTests_compare(testIndex, "addVertex", "Adding a vertex", reference,
+                   results);
+}
+
+void Tests::runTests_sweep(const unsigned int &testIndex) {
+  CoxIter ci;
+
+  if (!readGraph(testIndex, ci) || ci.get_verticesCount() < 2)
+    return;
+
+  const unsigned int dimension(ci.get_dimension()); // 0 if not specified
+  vector<vector<unsigned int>> coxeterMatrix(ci.get_coxeterMatrix());
+
+  // Edge between the first two vertices: its order, 2 and 3
+  vector<unsigned int> orders(1, coxeterMatrix[0][1]);
+  for (unsigned int order(2); order <= 3; order++) {
+    if (order != orders[0])
+      orders.push_back(order);
+  }
+
+  vector<vector<unsigned int>> assignments;
+  vector<CoxIter_Results> sweepResults;
+
+  ci.set_checkCocompactness(true);
+  ci.set_checkCofiniteness(true);
+  if (!ci.sweepEdgesOrders(vector<pair<string, string>>(
+                               1, make_pair(ci.get_vertexLabel(0),
+                                            ci.get_vertexLabel(1))),
+                           vector<vector<unsigned int>>(1, orders),
+                           assignments, sweepResults)) {
+    testsSucceded["sweep"][1]++;
+    runTestsError(testIndex, "sweep of edges orders", "success",
+                  ci.get_error());
+    return;
+  }
+
+  // Each assignment is compared to the graph with this order
+  for (size_t i(0); i < assignments.size(); i++) {
+    coxeterMatrix[0][1] = coxeterMatrix[1][0] = assignments[i][0];
+
+    CoxIter ciFresh(coxeterMatrix, dimension);
+    CoxIter_Results results;
+    analyse(ciFresh, results);
+
+    runTests_compare(testIndex, "sweep", "Sweep of edges orders", results,
+                     sweepResults[i]);
+  }
+}
+
+void Tests::runTests_symmetries(const unsigned int &testIndex,
+                                const CoxIter_Results &reference) {
+  CoxIter ci;
+  CoxIter_Results results;
+
+  ci.set_useSymmetries(true);
+  if (readGraph(testIndex, ci))
+    analyse(ci, results);
+
+  runTests_compare(testIndex, "symmetries", "Symmetries", reference, results);
+}
+
+void Tests::runTests_memoryBounded(const unsigned int &testIndex,
+                                   const CoxIter_Results &reference) {
+  // Memory-bounded mode, streamed check and both
+  const array<string, 3> names{"memoryBounded", "streamedCheck",
+                               "memoryBoundedStreamed"};
+
+  for (unsigned int k(0); k < 3; k++) {
+    CoxIter ci;
+    CoxIter_Results results;
+
+    ci.set_memoryBounded(k != 1);
+    ci.set_streamedCheck(k != 0);
+    if (readGraph(testIndex, ci))
+      analyse(ci, results);
+
+    runTests_compare(testIndex, names[k], testDescription[names[k]], reference,
+                     results);
+  }
+}
+
+void Tests::runTests_capi(const unsigned int &testIndex,
+                          const CoxIter_Results &reference) {
+  CoxIter ci;
+  CoxIter_Results expected(reference), results;
+
+  if (!readGraph(testIndex, ci))
+    return;
+
+  // The weights of the dotted edges cannot be given to the C interface
+  const bool testArithmeticity(tests[testIndex].testArithmeticity &&
+                               !ci.get_hasDottedLine());
+  if (testArithmeticity)
+    expected.isArithmetic = tests[testIndex].isArithmetic ? 1 : 0;
+
+  vector<unsigned int> orders;
+  for (const auto &row : ci.get_coxeterMatrix())
+    orders.insert(orders.end(), row.begin(), row.end());
+
+  coxiter_graph *graph(coxiter_create(orders.data(), ci.get_verticesCount(),
+                                      ci.get_dimension()));
+  coxiter_results r;
+
+  if (coxiter_run(graph, COXITER_EULER | COXITER_COCOMPACTNESS |
+                             COXITER_FINITE_COVOLUME | COXITER_SEQUENTIAL |
+                             (testArithmeticity ? COXITER_ARITHMETICITY : 0)) &&
+      coxiter_get_results(graph, &r)) {
+    results.dimension = r.dimension;
+    results.isDimensionGuessed = r.isDimensionGuessed;
+    results.isEulerCharacteristicComputed = r.isEulerCharacteristicComputed;
+    results.isCocompact = r.isCocompact;
+    results.isFiniteCovolume = r.isFiniteCovolume;
+    results.isArithmetic = r.isArithmetic;
+
+    results.fVector = vector<unsigned int>(r.fVectorSize);
+    coxiter_get_fVector(graph, results.fVector.data(), r.fVectorSize);
+
+    string euler(coxiter_get_eulerCharacteristic(graph, nullptr, 0), '\0');
+    coxiter_get_eulerCharacteristic(graph, &euler[0], euler.size() + 1);
+    results.eulerCharacteristic = MPZ_rational(euler);
+  }
+
+  runTests_compare(testIndex, "capi", "C interface", expected, results);
+
+  // A second call gives only the results asked in this call
+  const string expectedSecondCall(
+      "Euler characteristic not computed, cocompact -2, finite covolume " +
+      to_string(reference.isFiniteCovolume) + ", arithmetic -2");
+  string computedSecondCall;
+
+  if (coxiter_run(graph, COXITER_FINITE_COVOLUME | COXITER_SEQUENTIAL) &&
+      coxiter_get_results(graph, &r))
+    computedSecondCall =
+        string("Euler characteristic ") +
+        (r.isEulerCharacteristicComputed ? "computed" : "not computed") +
+        ", cocompact " + to_string(r.isCocompact) + ", finite covolume " +
+        to_string(r.isFiniteCovolume) + ", arithmetic " +
+        to_string(r.isArithmetic);
+  else
+    computedSecondCall = coxiter_error(graph);
+
+  if (expectedSecondCall == computedSecondCall) {
+    testsSucceded["capiSecondCall"][0]++;
+    of << "OK\tC interface (second call)\t\t" << tests[testIndex].filename
+       << endl;
+  } else {
+    testsSucceded["capiSecondCall"][1]++;
+    runTestsError(testIndex, "C interface (second call)", expectedSecondCall,
+                  computedSecondCall);
+  }
+
+  coxiter_destroy(graph);
+}
+
+void Tests::runTests_index2(const unsigned int &testIndex) {
+  CoxIter ci;
+
+  if (!readGraph(testIndex, ci))
+    return;
+
+  // The subgraphs of the doubled graph are derived from the ones of the
+  // explored graph (see CoxIter::set_coxeterMatrix_index2)
+  ci.exploreGraph();
+
+  // The graph is doubled twice (if possible), along the first admissible
+  // vertex
+  Index2 index2(&ci);
+  unsigned int doublingsCount(0);
+  for (unsigned int k(0); k < 2; k++) {
+    const vector<string> labels(ci.get_str_map_vertices_indexToLabel());
+    for (const auto &label : labels) {
+      if (index2.isVertexAdmissible(label)) {
+        if (index2.removeVertex(label))
+          doublingsCount++;
+        break;
+      }
+    }
+  }
+
+  if (!doublingsCount)
+    return;
+
+  CoxIter ciFresh(ci.get_coxeterMatrix(), ci.get_dimension());
+  ciFresh.exploreGraph();
+
+  const string expected(graphsListsToString(ciFresh)),
+      computed(graphsListsToString(ci));
+
+  if (expected == computed) {
+    testsSucceded["index2"][0]++;
+    of << "OK\tIndex 2 (derived subgraphs)\t\t" << tests[testIndex].filename
+       << endl;
+  } else {
+    testsSucceded["index2"][1]++;
+    runTestsError(testIndex, "Index 2 (derived subgraphs)", expected,
+                  computed);
+  }
+}
+
+void Tests::runTests_compare(const unsigned int &testIndex, const string &test,
+                             const string &description,
+                             const CoxIter_Results &expected,
+                             const CoxIter_Results &computed) {
+  const string strExpected(resultsToString(expected)),
+      strComputed(resultsToString(computed));
+
+  if (strExpected == strComputed) {
+    testsSucceded[test][0]++;
+    of << "OK\t" << description << "\t\t" << tests[testIndex].filename
+       << endl;
+  } else {
+    testsSucceded[test][1]++;
+    runTestsError(testIndex, description, strExpected, strComputed);
+  }
+}
+
 void Tests::runTestsError(const unsigned int &testIndex, const string &test,
                           const string &expected, const string &computed) {
   of << "Error: " << test << "\t in " << tests[testIndex].filename << endl;
@@ -628,6 +1025,42 @@ string Tests::strIntToString(const int &i) {
     return "?";
 }
 
+string Tests::resultsToString(const CoxIter_Results &results) {
+  if (!results.isEulerCharacteristicComputed)
+    return "not computed";
+
+  return "dimension " + to_string(results.dimension) +
+         (results.isDimensionGuessed ? " (guessed)" : "") +
+         ", Euler characteristic " + results.eulerCharacteristic.to_string() +
+         ", f-vector (" + implode(",", results.fVector) + "), cocompact " +
+         strIntToString(results.isCocompact) + ", finite covolume " +
+         strIntToString(results.isFiniteCovolume) +
+         (results.isArithmetic != -2
+              ? ", arithmetic " + strIntToString(results.isArithmetic)
+              : "");
+}
+
+string Tests::graphsListsToString(const CoxIter &ci) {
+  vector<string> graphs;
+
+  for (unsigned int k(0); k < 2; k++) {
+    for (GraphsListIterator grIt(k ? ci.get_gl_graphsList_euclidean()
+                                   : ci.get_gl_graphsList_spherical());
+         grIt.ptr; ++grIt) {
+      vector<short unsigned int> vertices(grIt.ptr->vertices);
+      sort(vertices.begin(), vertices.end());
+
+      graphs.push_back(string(k ? "E" : "S") + to_string(grIt.ptr->type) +
+                       "," + to_string(grIt.ptr->dataSupp) + "(" +
+                       implode(",", vertices) + ")");
+    }
+  }
+
+  sort(graphs.begin(), graphs.end());
+
+  return implode(" ", graphs);
+}
+
 void Tests::runTests_displayInfo() {
   array<unsigned int, 2> iTotal({0, 0});
 
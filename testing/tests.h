@@ -24,8 +24,10 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 #define __TESTS_H__
 
 #include "../arithmeticity.h"
+#include "../coxiter.capi.h"
 #include "../coxiter.h"
 #include "../growthrate.h"
+#include "../index2.h"
 #include "../lib/numbers/mpz_rational.h"
 #include "../lib/regexp.h"
 #include "../signature.h"
@@ -36,6 +38,7 @@ along with CoxIter. If not, see <http://www.gnu.org/licenses/>.
 #include <iostream>
 #include <map>
 #include <omp.h>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -90,6 +93,9 @@ private:
   map<string, string> testDescription; ///< For each test, description
   unsigned int testsUnknownErrors;     ///< Number of other errors
 
+  unsigned int smallGraphsMaxVertices; ///< Graphs for which the results are
+                                       ///< also computed in other ways
+
 public:
   Tests();
 
@@ -118,11 +124,44 @@ private:
   void runTests_cocompactness_cofiniteness(const unsigned int &testIndex,
                                            CoxIter *ci);
   void runTests_growth(const unsigned int &testIndex, CoxIter *ci);
+  void runTests_growthRateThreshold(const unsigned int &testIndex,
+                                    CoxIter *ci);
   void runTests_signature(const unsigned int &testIndex, CoxIter *ci,
                           const unsigned int &dim);
   void runTests_euler(const unsigned int &testIndex, CoxIter *ci);
   void runTests_fVector(const unsigned int &testIndex, CoxIter *ci);
 
+  /*!
+   * 	\fn runTests_reference
+   * 	\brief Read the graph and compute the results used by the comparisons
+   * (Euler characteristic, f-vector, cocompactness, finite covolume)
+   *
+   * 	\param testIndex(const unsigned int &) Index of the test
+   * 	\param results(CoxIter_Results &) The results
+   * 	\return True if success
+   */
+  bool runTests_reference(const unsigned int &testIndex,
+                          CoxIter_Results &results);
+  void runTests_binary(const unsigned int &testIndex,
+                       const CoxIter_Results &reference);
+  void runTests_removeAddVertex(const unsigned int &testIndex,
+                                const CoxIter_Results &reference);
+  void runTests_sweep(const unsigned int &testIndex);
+  void runTests_symmetries(const unsigned int &testIndex,
+                           const CoxIter_Results &reference);
+  void runTests_memoryBounded(const unsigned int &testIndex,
+                              const CoxIter_Results &reference);
+  void runTests_capi(const unsigned int &testIndex,
+                     const CoxIter_Results &reference);
+  void runTests_index2(const unsigned int &testIndex);
+
+  bool readGraph(const unsigned int &testIndex, CoxIter &ci);
+  bool analyse(CoxIter &ci, CoxIter_Results &results);
+  void runTests_compare(const unsigned int &testIndex, const string &test,
+                        const string &description,
+                        const CoxIter_Results &expected,
+                        const CoxIter_Results &computed);
+
   void runTestsError(const unsigned int &testIndex, const string &test,
                      const string &expected, const string &computed);
 
@@ -130,6 +169,8 @@ private:
   void runTests_displayInfo();
 
   string strIntToString(const int &i); ///< [*, 0, 1] => "?", "no", "yes"
+  string resultsToString(const CoxIter_Results &results);
+  string graphsListsToString(const CoxIter &ci); ///< Sorted connected graphs
 };
 
 #endif